@@ -1,12 +1,24 @@
 
 #include <fstream>
 #include "CodeGenerator.h"
+#include "../Profile/Profile.h"
 using namespace std;
 
-/* initialize class variable */
-int CodeGenerator::currOffset = 0;
+/* initialize class variables; the first word is at 0($sp) */
+int CodeGenerator::currOffset = 4;
+int CodeGenerator::holeOffset = 0;
+int CodeGenerator::holeSize = 0;
 
 CodeGenerator::CodeGenerator(const string & filename) {
+    needBoundsHandler = false;
+    profiling = false;
+    current = new FunctionCode;
+    stringSpool = nullptr;
+    coldSpool = nullptr;
+    sourceLine = nullptr;
+    annotateLines = false;
+    statistics = nullptr;
+
     codeFile.open(filename, ios::out);
     if (!codeFile) {
         throw string("unable to open code file: " + filename);
@@ -15,8 +27,21 @@ CodeGenerator::CodeGenerator(const string & filename) {
     writeProlog();
 }
 CodeGenerator::~CodeGenerator() {
+    flush();
+    delete current;
+
+    if (statistics && !statistics->close())
+        cerr << "cmm: error: unable to write statistics: " << statsFile
+             << endl;
+    delete statistics;
+
     writePostlog();
     codeFile.close();
+
+    if (stringSpool)
+        fclose(stringSpool);
+    if (coldSpool)
+        fclose(coldSpool);
 }
 
 void CodeGenerator::writeProlog() {
@@ -33,28 +58,266 @@ void CodeGenerator::writePostlog() {
     codeFile << "\n# Postlog:"        << endl
         << "la $a0 ProgEnd"         << endl
         << "li $v0 4"               << endl
-        << "syscall"                << endl
-        << "li $v0 10"              << endl
-        << "syscall"                << endl
-        << ".data"                  << endl
-        << "ProgStart: \t .asciiz \"Program Start\\n\""  << endl
+        << "syscall"                << endl;
+
+    if (profiling)
+        writeProfileDump();
+
+    codeFile << "li $v0 10"         << endl
+        << "syscall"                << endl;
+
+    if (needBoundsHandler)
+        writeBoundsHandler();
+
+    if (coldSpool && ftell(coldSpool) > 0) {
+        codeFile << "\n# Cold code:" << endl;
+        writeSpool(coldSpool);
+    } else if (!coldCode.empty()) {
+        codeFile << "\n# Cold code:" << endl << coldCode;
+    }
+
+    codeFile << ".data"             << endl;
+
+    /* counters first, while the data section is still word aligned */
+    for (string label : profileCounters)
+        codeFile << "count_" << label << ": \t .word 0" << endl;
+
+    codeFile << "ProgStart: \t .asciiz \"Program Start\\n\""  << endl
         << "ProgEnd:   \t .asciiz \"Program End\\n\""    << endl;
 
+    if (needBoundsHandler)
+        codeFile << "BoundsMsg: \t .asciiz \"array index out of bounds\\n\""
+                 << endl;
+
+    if (profiling) {
+        codeFile << "ProfHeader: \t .asciiz \"" << Profile::header
+                 << "\\n\"" << endl;
+        for (string label : profileCounters)
+            codeFile << "name_" << label << ": \t .asciiz \"" << label
+                     << " \"" << endl;
+    }
+
     writeStaticStrings();
 }
-int CodeGenerator::getCurrOffsetAndUpdate(int offset) {
-    int temp = currOffset;
-    // multiply offset by 4 (# of bytes in word on stack)
-    currOffset -= offset * 4;
-    return temp;
+/* runtime bounds checks branch here when an array index is out of range */
+void CodeGenerator::writeBoundsHandler() {
+    codeFile << "BoundsError:"      << endl
+        << "la $a0 BoundsMsg"       << endl
+        << "li $v0 4"               << endl
+        << "syscall"                << endl
+        << "li $v0 10"              << endl
+        << "syscall"                << endl;
+}
+/* print "<label> <count>" for every counter after the profile header */
+void CodeGenerator::writeProfileDump() {
+    codeFile << "la $a0 ProfHeader"     << endl
+        << "li $v0 4"                   << endl
+        << "syscall"                    << endl;
+
+    for (string label : profileCounters) {
+        codeFile << "la $a0 name_" << label << endl
+            << "li $v0 4"               << endl
+            << "syscall"                << endl
+            << "lw $a0 count_" << label << endl
+            << "li $v0 1"               << endl
+            << "syscall"                << endl
+            << "li $a0 '\\n'"           << endl
+            << "li $v0 11"              << endl
+            << "syscall"                << endl;
+    }
+}
+void CodeGenerator::enableProfiling() {
+    profiling = true;
+}
+/* count the executions of the code that follows, which starts at label */
+void CodeGenerator::genProfileCounter(string label) {
+    profileCounters.push_back(label);
+
+    genCode("lw $t0, count_" + label);
+    genCode("addi $t0, $t0, 1");
+    genCode("sw $t0, count_" + label);
+}
+int CodeGenerator::getCurrOffset() {
+    return currOffset;
+}
+/* Reserve offset elements of width bytes (1 or 4) on the stack and return
+ * the location of the first; the others follow at lower addresses.  Words
+ * are aligned; chars are packed, into the bytes skipped by the last
+ * alignment if they fit. */
+int CodeGenerator::getCurrOffsetAndUpdate(int offset, int width) {
+    if (width == 1 && offset <= holeSize) {
+        holeOffset -= offset;
+        holeSize -= offset;
+        return holeOffset + offset - 1;
+    }
+    if (width == 1) {
+        currOffset -= offset;
+        return currOffset + offset - 1;
+    }
+
+    int aligned = currOffset & ~(width - 1);
+    if (aligned != currOffset) {
+        holeOffset = currOffset;
+        holeSize = currOffset - aligned;
+    }
+    currOffset = aligned - offset * width;
+    return aligned - width;
 }
 void CodeGenerator::genCode(string code) {
-    codeFile << code << endl;
+    current->genCode(code, sourceLine ? *sourceLine : 0);
+}
+size_t CodeGenerator::genPlaceholder() {
+    return current->genPlaceholder(sourceLine ? *sourceLine : 0);
+}
+void CodeGenerator::startFragment() {
+    current->startFragment();
+}
+CodeFragment CodeGenerator::endFragment() {
+    return current->endFragment();
+}
+void CodeGenerator::genFragment(const CodeFragment &fragment) {
+    current->genFragment(fragment);
+}
+void CodeGenerator::genColdFragment(const CodeFragment &fragment) {
+    current->genColdFragment(fragment);
+}
+/* The current function is complete: finish it, then write out its code. */
+void CodeGenerator::flush(Finisher finish) {
+    FunctionCode *code = current;
+    current = new FunctionCode;
+
+    if (finish)
+        finish(*code);
+    code->render(annotateLines, statistics != nullptr);
+
+    codeFile << code->text;
+    if (coldSpool)
+        fputs(code->coldText.c_str(), coldSpool);
+    else
+        coldCode += code->coldText;
+    if (code->needBoundsHandler)
+        needBoundsHandler = true;
+    /* code left over after a syntax error belongs to no function */
+    if (statistics && !code->stats.name.empty())
+        statistics->add(code->stats);
+    delete code;
+}
+/* Keep memory use independent of the length of the program: data that is
+ * only written out at the end goes to temporary files. */
+void CodeGenerator::enableStreaming() {
+    stringSpool = tmpfile();
+    coldSpool = tmpfile();
+    if (!stringSpool || !coldSpool)
+        throw string("unable to create temporary file");
+}
+/* copy what has been written to spool to the code file */
+void CodeGenerator::writeSpool(FILE *spool) {
+    char buffer[BUFSIZ];
+    size_t count;
+
+    rewind(spool);
+    while ((count = fread(buffer, 1, sizeof buffer, spool)) > 0)
+        codeFile.write(buffer, count);
+}
+/* line is read whenever code is generated, to tag it with its source line */
+void CodeGenerator::trackLines(const int *line) {
+    sourceLine = line;
+}
+/* precede the code of each source line by a "# line N" comment */
+void CodeGenerator::enableLineAnnotations() {
+    annotateLines = true;
+}
+/* write per-function statistics to filename as each function is flushed;
+ * false if the file cannot be opened */
+bool CodeGenerator::enableStatistics(string filename, string source) {
+    statistics = new Statistics;
+    statsFile = filename;
+    if (statistics->open(filename, source))
+        return true;
+
+    delete statistics;
+    statistics = nullptr;
+    return false;
+}
+
+FunctionCode::FunctionCode() {
+    needBoundsHandler = false;
+    fragments.push_back(CodeFragment());
+}
+void FunctionCode::genCode(string code, int line) {
+    fragments.back().push_back(CodeLine {code, -1, line});
+}
+/* reserve a spot for code that is not known yet; returns its handle */
+size_t FunctionCode::genPlaceholder(int line) {
+    int placeholder = placeholders.size();
+    placeholders.push_back("");
+    fragments.back().push_back(CodeLine {"", placeholder, line});
+    return placeholder;
+}
+void FunctionCode::fillPlaceholder(size_t placeholder, string code) {
+    placeholders[placeholder] = code;
+}
+/* collect the code generated from now on in a fragment of its own, to be
+ * placed by the caller once it is complete; fragments nest */
+void FunctionCode::startFragment() {
+    fragments.push_back(CodeFragment());
+}
+CodeFragment FunctionCode::endFragment() {
+    CodeFragment fragment = fragments.back();
+    fragments.pop_back();
+    return fragment;
+}
+void FunctionCode::genFragment(const CodeFragment &fragment) {
+    fragments.back().insert(fragments.back().end(),
+                            fragment.begin(), fragment.end());
+}
+/* the fragment must not fall through; it ends with a branch back */
+void FunctionCode::genColdFragment(const CodeFragment &fragment) {
+    coldFragment.insert(coldFragment.end(), fragment.begin(), fragment.end());
+}
+void FunctionCode::requestBoundsHandler() {
+    needBoundsHandler = true;
+}
+void FunctionCode::writeFragment(const CodeFragment &fragment, string &out,
+                                 bool annotate, bool count) {
+    int lastLine = 0;
+    for (const CodeLine &line : fragment) {
+        const string &code = line.placeholder == -1
+                             ? line.code : placeholders[line.placeholder];
+
+        if (annotate && line.line != lastLine) {
+            out += "# line " + to_string(line.line) + '\n';
+            lastLine = line.line;
+        }
+        if (count)
+            stats.countCode(code, line.line);
+
+        out += code;
+        out += '\n';
+    }
+}
+/* turn the buffered code into text; placeholders must be filled in by now.
+ * With annotate, "# line N" comments mark where each source line's code
+ * starts; with count, the code is counted into stats. */
+void FunctionCode::render(bool annotate, bool count) {
+    writeFragment(fragments[0], text, annotate, count);
+    writeFragment(coldFragment, coldText, annotate, count);
+
+    fragments.clear();
+    placeholders.clear();
+    coldFragment.clear();
 }
 void CodeGenerator::addStaticString(string name, string lexeme) {
-    staticStrings.push_back(name + ": \t\t .asciiz " + lexeme);
+    string s = name + ": \t\t .asciiz " + lexeme;
+    if (stringSpool)
+        fprintf(stringSpool, "%s\n", s.c_str());
+    else
+        staticStrings.push_back(s);
 }
 void CodeGenerator::writeStaticStrings() {
+    if (stringSpool)
+        writeSpool(stringSpool);
+
     for (string s : staticStrings)
         codeFile << s << endl;
 }
\ No newline at end of file
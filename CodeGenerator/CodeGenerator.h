@@ -1,28 +1,127 @@
 #pragma once
 
+#include <cstdio>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <vector>
+#include "../Statistics/Statistics.h"
 using namespace std;
 
+/* One line of buffered code.  A placeholder line has no code of its own;
+ * it stands for whatever is later given to fillPlaceholder(). */
+struct CodeLine {
+    string code;
+    int placeholder;        // -1 if the line is not a placeholder
+    int line;               // source line the code was generated for
+};
+typedef vector<CodeLine> CodeFragment;
+
+/* The code of one function while it is generated and until it is written
+ * to the code file by CodeGenerator::flush(). */
+class FunctionCode {
+
+    private:
+        /* code of the function is held in fragments[0]; code for a
+         * fragment that has been started goes to the last one */
+        vector<CodeFragment> fragments;
+        vector<string> placeholders;
+
+        /* rarely executed code, placed after the postlog out of the way of
+         * the hot path */
+        CodeFragment coldFragment;
+
+        void writeFragment(const CodeFragment &, string &,
+                           bool annotate, bool count);
+
+    public:
+        /* set once a runtime bounds check has been generated */
+        bool needBoundsHandler;
+
+        /* filled in by render() */
+        string text;
+        string coldText;
+        FunctionStats stats;
+
+        FunctionCode();
+        void genCode(string code, int line);
+        size_t genPlaceholder(int line);
+        void fillPlaceholder(size_t placeholder, string code);
+        void startFragment();
+        CodeFragment endFragment();
+        void genFragment(const CodeFragment &);
+        void genColdFragment(const CodeFragment &);
+        void requestBoundsHandler();
+        void render(bool annotate, bool count);
+};
+
+/* Finishes the code of a function before it is rendered, e.g. by filling
+ * in its placeholders. */
+typedef function<void(FunctionCode &)> Finisher;
+
 class CodeGenerator {
 
     private:
-        /* class variable to represent current offset from stack pointer */
+        /* class variables to represent current offset from stack pointer:
+         * the lowest byte in use, and the bytes skipped when a word was
+         * aligned, which are left for chars */
         static int currOffset;
+        static int holeOffset;
+        static int holeSize;
 
         fstream codeFile;
         vector<string> staticStrings;
 
+        /* the function being generated */
+        FunctionCode *current;
+
+        string coldCode;
+
+        /* --stream: static strings and cold code wait in temporary files
+         * instead of memory */
+        FILE *stringSpool;
+        FILE *coldSpool;
+
+        /* the source line being compiled, if tracked */
+        const int *sourceLine;
+
+        /* --annotate-lines and --emit-stats */
+        bool annotateLines;
+        Statistics *statistics;
+        string statsFile;
+
+        /* set once a runtime bounds check has been generated */
+        bool needBoundsHandler;
+
+        /* set by --profile-generate; labels counted by genProfileCounter() */
+        bool profiling;
+        vector<string> profileCounters;
+
         void writeStaticStrings();
+        void writeBoundsHandler();
+        void writeProfileDump();
+        void writeSpool(FILE *);
 
     public:
         CodeGenerator(const string & filename);
         ~CodeGenerator();
         void writeProlog();
         void writePostlog();
-        int getCurrOffsetAndUpdate(int offset = 1);
+        int getCurrOffsetAndUpdate(int offset = 1, int width = 4);
+        int getCurrOffset();
         void genCode(string code);
+        size_t genPlaceholder();
+        void startFragment();
+        CodeFragment endFragment();
+        void genFragment(const CodeFragment &);
+        void genColdFragment(const CodeFragment &);
+        void flush(Finisher finish = nullptr);
+        void enableStreaming();
+        void trackLines(const int *line);
+        void enableLineAnnotations();
+        bool enableStatistics(string filename, string source);
         void addStaticString(string, string);
-};
\ No newline at end of file
+        void enableProfiling();
+        void genProfileCounter(string label);
+};
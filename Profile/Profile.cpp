@@ -0,0 +1,49 @@
+/*
+ * Profile.cpp
+ */
+
+#include <fstream>
+#include <sstream>
+#include "Profile.h"
+using namespace std;
+
+const string Profile::header = "# cmm profile";
+
+Profile::Profile() {
+    loaded = false;
+}
+/* read the counts from the output of an instrumented run */
+bool Profile::load(const string &filename) {
+    ifstream in(filename);
+    if (!in)
+        return false;
+
+    string line;
+    bool inProfile = false;
+    while (getline(in, line)) {
+        if (line == header) {
+            counts.clear();
+            inProfile = true;
+            continue;
+        }
+        if (!inProfile)
+            continue;
+
+        istringstream fields(line);
+        string label;
+        long count;
+        if (fields >> label >> count)
+            counts[label] = count;
+    }
+
+    loaded = inProfile;
+    return loaded;
+}
+bool Profile::isLoaded() {
+    return loaded;
+}
+/* labels the run never reached (or that the profile lacks) count as 0 */
+long Profile::count(const string &label) {
+    auto itr = counts.find(label);
+    return itr == counts.end() ? 0 : itr->second;
+}
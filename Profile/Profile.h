@@ -0,0 +1,27 @@
+/*
+ * Profile.h
+ */
+
+#pragma once
+#include <string>
+#include <unordered_map>
+using namespace std;
+
+/* Execution counts collected by a program compiled with --profile-generate.
+ * The instrumented program prints one "<label> <count>" line per label
+ * after the header line "# cmm profile"; the program's own output before
+ * the header is ignored.  Labels are numbered in source order, so the
+ * counts apply to the same source compiled again. */
+class Profile {
+    private:
+        unordered_map<string, long> counts;
+        bool loaded;
+
+    public:
+        static const string header;
+
+        Profile();
+        bool load(const string &filename);
+        bool isLoaded();
+        long count(const string &label);
+};
@@ -0,0 +1,317 @@
+/*
+ * RangeAnalysis.cpp
+ */
+
+#include <algorithm>
+#include <climits>
+#include "RangeAnalysis.h"
+using namespace std;
+
+/* By default nothing is known about a value. */
+ValueRange::ValueRange() {
+    isConst = false;
+    value = 0;
+    nonNeg = false;
+    var = nullptr;
+    isElement = false;
+    op = 0;
+    guardVar = nullptr;
+    guardBound = nullptr;
+    guardConst = 0;
+}
+ValueRange ValueRange::constant(int value) {
+    ValueRange range;
+    range.isConst = true;
+    range.value = value;
+    range.nonNeg = value >= 0;
+    return range;
+}
+/* the value of a variable is non-negative if every value assigned to it is */
+ValueRange ValueRange::variable(Symbol *var, bool isElement) {
+    ValueRange range;
+    range.nonNeg = true;
+    range.deps.insert(var);
+    range.var = var;
+    range.isElement = isElement;
+    return range;
+}
+/* range of (r1 op r2), op being one of the operators passed to genCodeExpr */
+ValueRange ValueRange::combine(const ValueRange &r1, const ValueRange &r2,
+                                char op) {
+    ValueRange range;
+
+    /* fold constants */
+    if (r1.isConst && r2.isConst) {
+        long long v1 = r1.value, v2 = r2.value, v = 0;
+        bool folded = true;
+        switch (op) {
+            case '<':   v = v1 < v2;            break;
+            case '>':   v = v1 > v2;            break;
+            case '+':   v = v1 + v2;            break;
+            case '-':   v = v1 - v2;            break;
+            case '*':   v = v1 * v2;            break;
+            case '/':   folded = v2 != 0;
+                        v = folded ? v1 / v2 : 0;
+                        break;
+            case '=':   v = v1 == v2;           break;
+            case '|':   v = v1 | v2;            break;
+            case '&':   v = v1 && v2;           break;
+        }
+        if (folded && v >= INT_MIN && v <= INT_MAX)
+            return constant((int) v);
+    }
+
+    switch (op) {
+        case '+':
+        case '*':   /* sums and products of non-negative values */
+        case '|':   /* bitwise or, as genCodeExprOP emits it */
+                    range.nonNeg = r1.nonNeg && r2.nonNeg;
+                    range.deps = r1.deps;
+                    range.deps.insert(r2.deps.begin(), r2.deps.end());
+                    if (range.nonNeg) {
+                        range.op = op;
+                        range.left = make_shared<ValueRange>(r1);
+                        range.right = make_shared<ValueRange>(r2);
+                    }
+                    break;
+        case '-':
+        case '/':   break;
+        default:    /* comparisons and logical and yield 0 or 1 */
+                    range.nonNeg = true;
+                    break;
+    }
+
+    /* remember loop and if conditions of the form i < n and n > i */
+    const ValueRange &lhs = op == '<' ? r1 : r2;
+    const ValueRange &rhs = op == '<' ? r2 : r1;
+    if ((op == '<' || op == '>') && lhs.var && !lhs.isElement) {
+        if (rhs.var && !rhs.isElement) {
+            range.guardVar = lhs.var;
+            range.guardBound = rhs.var;
+        } else if (rhs.isConst) {
+            range.guardVar = lhs.var;
+            range.guardConst = rhs.value;
+        }
+    }
+
+    return range;
+}
+
+RangeAnalysis::RangeAnalysis() {
+    reset();
+}
+void RangeAnalysis::enterRegion(Region region) {
+    region.start = pos++;
+    region.end = INT_MAX;
+    region.parent = current;
+    regions.push_back(region);
+    current = regions.size() - 1;
+}
+void RangeAnalysis::leaveRegion() {
+    regions[current].end = pos++;
+    current = regions[current].parent;
+}
+/* while_keyword : WHILE; the loop spans its condition and its body */
+void RangeAnalysis::enterLoop() {
+    Region region = Region();
+    region.isLoop = true;
+    enterRegion(region);
+}
+void RangeAnalysis::leaveLoop() {
+    leaveRegion();
+}
+/* the statement controlled by an if or while condition */
+void RangeAnalysis::enterGuard(const ValueRange &condition) {
+    Region region = Region();
+    region.guardVar = condition.guardVar;
+    region.guardBound = condition.guardBound;
+    region.guardConst = condition.guardConst;
+    enterRegion(region);
+}
+void RangeAnalysis::leaveGuard() {
+    leaveRegion();
+}
+/* record that the variable (or an element of the array) target was
+ * assigned a value with the given range */
+void RangeAnalysis::assign(Symbol *target, const ValueRange &value) {
+    assignedAt[target].push_back(pos);
+    assignments.push_back(Assignment {target, current, pos++, value});
+}
+void RangeAnalysis::addCheck(size_t slot, Symbol *array, Symbol *index) {
+    checks.push_back(BoundsCheck {slot, array, index, current, pos++, false});
+}
+/* is the symbol assigned strictly between the two positions? */
+bool RangeAnalysis::isAssigned(Symbol *symbol, int from, int to) {
+    auto found = assignedAt.find(symbol);
+    if (found == assignedAt.end())
+        return false;
+
+    const vector<int> &positions = found->second;
+    auto next = upper_bound(positions.begin(), positions.end(), from);
+    return next != positions.end() && *next < to;
+}
+/* smallest n such that symbol < n holds at the given region and position;
+ * INT_MAX if there is none */
+int RangeAnalysis::upperBound(Symbol *symbol, int region, int pos) {
+    int max = maxValue(symbol);
+    int best = max == INT_MAX ? INT_MAX : max + 1;
+
+    /* walk outwards looking for guards symbol < n */
+    int end = pos;
+    for (int r = region; r != -1; r = regions[r].parent) {
+        const Region &guard = regions[r];
+
+        if (guard.guardVar == symbol
+                && !isAssigned(symbol, guard.start, end)
+                && !(guard.guardBound
+                    && isAssigned(guard.guardBound, guard.start, end))) {
+            int bound = guard.guardBound ? maxValue(guard.guardBound)
+                                         : guard.guardConst;
+            if (bound < best)
+                best = bound;
+        }
+
+        /* assignments anywhere in an enclosing loop can reach the point */
+        if (guard.isLoop)
+            end = guard.end;
+    }
+    return best;
+}
+/* largest value the symbol can hold (it starts out as zero), as far as
+ * computeMaxValues() has got */
+int RangeAnalysis::maxValue(Symbol *symbol) {
+    auto found = maxValues.find(symbol);
+    return found == maxValues.end() ? 0 : found->second;
+}
+/* largest value the assignment can store, given the current maxValues */
+int RangeAnalysis::maxAssigned(const Assignment &a) {
+    if (a.value.isConst)
+        return a.value.value;
+    if (a.value.var && !a.value.isElement) {
+        int bound = upperBound(a.value.var, a.region, a.pos);
+        if (bound != INT_MAX)
+            return bound - 1;
+    }
+    return INT_MAX;
+}
+/* Fill in maxValues.  They only grow from zero, and an assignment is
+ * looked at again whenever the maximum of a symbol it copies from, or of
+ * the bound of a guard on that symbol, grows.  A copy never stores more
+ * than its source can hold, so this ends once every maximum covers all
+ * the values assigned to the symbol. */
+void RangeAnalysis::computeMaxValues() {
+    /* the assignments whose maxAssigned() depends on each symbol */
+    map<Symbol *, vector<size_t>> readers;
+    for (size_t i = 0; i < assignments.size(); i++) {
+        const Assignment &a = assignments[i];
+        Symbol *source = a.value.var;
+        if (a.value.isConst || !source || a.value.isElement)
+            continue;
+
+        readers[source].push_back(i);
+        for (int r = a.region; r != -1; r = regions[r].parent)
+            if (regions[r].guardVar == source && regions[r].guardBound)
+                readers[regions[r].guardBound].push_back(i);
+    }
+
+    vector<size_t> worklist;
+    vector<bool> queued(assignments.size(), true);
+    for (size_t i = assignments.size(); i > 0; i--)
+        worklist.push_back(i - 1);
+
+    while (!worklist.empty()) {
+        size_t i = worklist.back();
+        worklist.pop_back();
+        queued[i] = false;
+
+        Symbol *target = assignments[i].target;
+        int value = maxAssigned(assignments[i]);
+        if (value <= maxValue(target))
+            continue;
+
+        maxValues[target] = value;
+        for (size_t reader : readers[target]) {
+            if (!queued[reader]) {
+                queued[reader] = true;
+                worklist.push_back(reader);
+            }
+        }
+    }
+}
+/* largest value of an expression evaluated at the given region and
+ * position, with 32-bit wraparound ignored; more than INT_MAX if it is
+ * not bounded or might overflow */
+long long RangeAnalysis::maxResult(const ValueRange &value, int region,
+                                   int pos) {
+    const long long unbounded = (long long) INT_MAX + 1;
+
+    if (value.isConst)
+        return value.value;
+    if (value.op) {
+        long long max1 = maxResult(*value.left, region, pos);
+        long long max2 = maxResult(*value.right, region, pos);
+        if (max1 >= unbounded || max2 >= unbounded)
+            return unbounded;
+        /* a | b never exceeds a + b for non-negative a and b */
+        return value.op == '*' ? max1 * max2 : max1 + max2;
+    }
+    if (value.var && !value.isElement) {
+        int bound = upperBound(value.var, region, pos);
+        return bound == INT_MAX ? unbounded : bound - 1;
+    }
+    /* comparisons and logical and yield 0 or 1 */
+    if (value.nonNeg && value.deps.empty())
+        return 1;
+    return unbounded;
+}
+bool RangeAnalysis::isRedundant(const BoundsCheck &check,
+                                const set<Symbol *> &negative) {
+    return !negative.count(check.index)
+        && upperBound(check.index, check.region, check.pos)
+            <= check.array->size;
+}
+/* decide which of the checks in the current function are redundant */
+vector<BoundsCheck> RangeAnalysis::resolve() {
+    computeMaxValues();
+
+    /* find the symbols that may hold a negative value */
+    set<Symbol *> negative;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const Assignment &a : assignments) {
+            if (negative.count(a.target))
+                continue;
+
+            bool nonNeg = a.value.nonNeg;
+            for (Symbol *dep : a.value.deps)
+                if (negative.count(dep))
+                    nonNeg = false;
+
+            /* sums and products of large values wrap around */
+            if (nonNeg && a.value.op
+                    && maxResult(a.value, a.region, a.pos) > INT_MAX)
+                nonNeg = false;
+
+            if (!nonNeg) {
+                negative.insert(a.target);
+                changed = true;
+            }
+        }
+    }
+
+    for (BoundsCheck &check : checks)
+        check.redundant = isRedundant(check, negative);
+
+    return checks;
+}
+/* forget everything about the previous function */
+void RangeAnalysis::reset() {
+    regions.clear();
+    assignments.clear();
+    checks.clear();
+    assignedAt.clear();
+    maxValues.clear();
+    current = -1;
+    pos = 0;
+}
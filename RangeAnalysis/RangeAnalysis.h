@@ -0,0 +1,123 @@
+/*
+ * RangeAnalysis.h
+ */
+
+#pragma once
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+#include "../SymbolTable/SymbolTable.h"
+using namespace std;
+
+/* What is known at compile time about the value of an expression.  Every
+ * ExpressionRecord carries one so that array subscripts can be proven to be
+ * in bounds. */
+struct ValueRange {
+    bool isConst;           // value is a compile-time constant
+    int value;              // the constant, if isConst
+    bool nonNeg;            // value >= 0, provided every symbol in deps is
+    set<Symbol *> deps;
+    Symbol *var;            // variable the value was read from, if any
+    bool isElement;         // var is an array and the value is one element
+
+    /* set for a non-constant +, * or | of non-negative operands; such a
+     * value is non-negative only if it cannot overflow, which resolve()
+     * decides from the bounds of the operands */
+    char op;
+    shared_ptr<const ValueRange> left;
+    shared_ptr<const ValueRange> right;
+
+    /* set when the value is the outcome of (guardVar < guardBound), or of
+     * (guardVar < guardConst) when guardBound is null */
+    Symbol *guardVar;
+    Symbol *guardBound;
+    int guardConst;
+
+    ValueRange();
+    static ValueRange constant(int value);
+    static ValueRange variable(Symbol *var, bool isElement);
+    static ValueRange combine(const ValueRange &, const ValueRange &, char op);
+};
+
+/* A runtime bounds check emitted into a code generator placeholder. */
+struct BoundsCheck {
+    size_t slot;            // placeholder holding the check
+    Symbol *array;
+    Symbol *index;
+    int region;             // innermost region the check appears in
+    int pos;
+    bool redundant;         // set by resolve() if the check can be dropped
+};
+
+/* RangeAnalysis proves runtime bounds checks redundant.  It works on one
+ * function at a time: the parser reports regions (loops and the statements
+ * guarded by a condition), assignments and checks as they are generated,
+ * and resolve() is called once the whole function has been seen.
+ *
+ * A check on a[i] is redundant when every value ever assigned to i is
+ * non-negative and i is below the size of a at the check.  The latter holds
+ * when the check sits in a region guarded by i < n (or n > i) where
+ *   - neither i nor n is assigned between the start of the region and the
+ *     check, nor anywhere in a loop nested in the region that holds the
+ *     check (its back edge could carry the assignment to the check), and
+ *   - n never exceeds the size of a,
+ * or when i itself never reaches the size of a.  A variable never exceeds
+ * a bound when each value assigned to it is a constant within the bound or
+ * a copy of a variable that is itself guarded below it at the assignment.
+ *
+ * Apart from the guards these are flow-insensitive facts over the whole
+ * function.  Stack slots are never reused and start out zero, so an
+ * unassigned variable satisfies them. */
+class RangeAnalysis {
+    private:
+        struct Region {
+            int start;
+            int end;
+            bool isLoop;
+            int parent;
+            Symbol *guardVar;
+            Symbol *guardBound;
+            int guardConst;
+        };
+        struct Assignment {
+            Symbol *target;
+            int region;
+            int pos;
+            ValueRange value;
+        };
+
+        vector<Region> regions;
+        vector<Assignment> assignments;
+        vector<BoundsCheck> checks;
+        int current;        // index of innermost open region, -1 if none
+        int pos;            // position of the next event
+
+        /* positions of the assignments to each symbol, in order */
+        map<Symbol *, vector<int>> assignedAt;
+
+        /* largest value each symbol can hold, filled in by
+         * computeMaxValues(); symbols that are never assigned hold zero */
+        map<Symbol *, int> maxValues;
+
+        void enterRegion(Region region);
+        void leaveRegion();
+        bool isAssigned(Symbol *, int from, int to);
+        bool isRedundant(const BoundsCheck &, const set<Symbol *> &negative);
+        int upperBound(Symbol *, int region, int pos);
+        int maxValue(Symbol *);
+        int maxAssigned(const Assignment &);
+        void computeMaxValues();
+        long long maxResult(const ValueRange &, int region, int pos);
+
+    public:
+        RangeAnalysis();
+        void enterLoop();
+        void leaveLoop();
+        void enterGuard(const ValueRange &condition);
+        void leaveGuard();
+        void assign(Symbol *target, const ValueRange &value);
+        void addCheck(size_t slot, Symbol *array, Symbol *index);
+        vector<BoundsCheck> resolve();
+        void reset();
+};
@@ -0,0 +1,122 @@
+/*
+ * Statistics.cpp
+ */
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include "Statistics.h"
+using namespace std;
+
+/* the class of an opcode as reported in the statistics */
+static string opcodeClass(const string &opcode) {
+    static const set<string> loads = { "lw", "lh", "lhu", "lb", "lbu" };
+    static const set<string> stores = { "sw", "sh", "sb" };
+    static const set<string> muldivs = { "mult", "div", "mul",
+                                         "mflo", "mfhi" };
+    static const set<string> moves = { "li", "la", "move" };
+    static const set<string> alus = { "add", "addi", "addu", "addiu",
+                                      "sub", "subu", "and", "andi",
+                                      "or", "ori", "xor", "xori",
+                                      "sll", "srl", "sra", "slt", "sltu",
+                                      "sgt", "seq", "sne" };
+
+    if (loads.count(opcode))    return "load";
+    if (stores.count(opcode))   return "store";
+    if (muldivs.count(opcode))  return "muldiv";
+    if (moves.count(opcode))    return "move";
+    if (alus.count(opcode))     return "alu";
+    if (opcode == "syscall")    return "syscall";
+    if (opcode[0] == 'b' || opcode[0] == 'j')
+        return "branch";
+    return "other";
+}
+/* JSON object of the counts: {"total": n, "load": n, ...} */
+static string toJson(const InstructionCounts &counts) {
+    ostringstream out;
+    out << "{\"total\": " << counts.total;
+    for (auto entry : counts.byClass)
+        out << ", \"" << entry.first << "\": " << entry.second;
+    out << "}";
+    return out.str();
+}
+static string quote(const string &s) {
+    string quoted = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+InstructionCounts::InstructionCounts() {
+    total = 0;
+}
+void InstructionCounts::add(const string &opcode) {
+    total++;
+    byClass[opcodeClass(opcode)]++;
+}
+
+FunctionStats::FunctionStats() {
+    frameBytes = 0;
+    temps = 0;
+    strings = 0;
+    labels = 0;
+}
+/* count one or more lines of generated code that came from a source line */
+void FunctionStats::countCode(const string &code, int line) {
+    string text;
+    istringstream lines(code);
+    while (getline(lines, text)) {
+        string opcode;
+        istringstream(text) >> opcode;
+
+        if (opcode.empty() || opcode[0] == '#')
+            continue;
+        if (opcode.back() == ':') {
+            labels++;
+            continue;
+        }
+
+        instructions.add(opcode);
+        this->lines[line].add(opcode);
+    }
+}
+
+/* start the JSON document; functions are added to its array */
+bool Statistics::open(const string &filename, const string &source) {
+    out.open(filename);
+    functions = 0;
+    out << "{" << endl
+        << "  \"source\": " << quote(source) << "," << endl
+        << "  \"functions\": [";
+    return bool(out);
+}
+void Statistics::add(const FunctionStats &f) {
+    out << (functions++ ? "," : "") << endl
+        << "    {" << endl
+        << "      \"name\": " << quote(f.name) << "," << endl
+        << "      \"frame_bytes\": " << f.frameBytes << "," << endl
+        << "      \"temps\": " << f.temps << "," << endl
+        << "      \"labels\": " << f.labels << "," << endl
+        << "      \"strings\": " << f.strings << "," << endl
+        << "      \"instructions\": " << toJson(f.instructions) << ","
+        << endl
+        << "      \"lines\": [";
+
+    bool first = true;
+    for (auto entry : f.lines) {
+        out << (first ? "" : ",") << endl
+            << "        {\"line\": " << entry.first
+            << ", \"instructions\": " << toJson(entry.second) << "}";
+        first = false;
+    }
+    out << endl << "      ]" << endl << "    }";
+}
+/* end the JSON document; false if any of it could not be written */
+bool Statistics::close() {
+    out << endl << "  ]" << endl << "}" << endl;
+    out.close();
+    return bool(out);
+}
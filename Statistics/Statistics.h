@@ -0,0 +1,48 @@
+/*
+ * Statistics.h
+ */
+
+#pragma once
+#include <fstream>
+#include <map>
+#include <string>
+using namespace std;
+
+/* Static instruction counts, in total and by opcode class (load, store,
+ * alu, muldiv, branch, move, syscall, other). */
+struct InstructionCounts {
+    int total;
+    map<string, int> byClass;
+
+    InstructionCounts();
+    void add(const string &opcode);
+};
+
+/* What the code of one function cost.  The name, frame size, temps and
+ * strings are known when parsing ends; the rest is counted from the
+ * generated code. */
+struct FunctionStats {
+    string name;
+    int frameBytes;         // stack handed out by getCurrOffsetAndUpdate
+    int temps;              // temps handed out by SymbolTable::getTemp
+    int strings;            // static strings added to the .data section
+    int labels;
+    InstructionCounts instructions;
+    map<int, InstructionCounts> lines;      // by source line
+
+    FunctionStats();
+    void countCode(const string &code, int line);
+};
+
+/* Writes the FunctionStats of a compilation out as JSON for --emit-stats.
+ * Each function is written when it is added, so none are kept. */
+class Statistics {
+    private:
+        ofstream out;
+        int functions;
+
+    public:
+        bool open(const string &filename, const string &source);
+        void add(const FunctionStats &);
+        bool close();
+};
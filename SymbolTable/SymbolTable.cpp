@@ -16,10 +16,16 @@ SymbolTable::SymbolTable()
 /* Destructor responsible for deleting all symbols added to ST and
 ST itself. */
 SymbolTable::~SymbolTable()
+{
+	delete releaseOldScopes();
+}
+
+/* Deletes the scopes and all symbols in them. */
+OldScopes::~OldScopes()
 {
 	/* Get an iterator to iterate through the list of scopes. */
-	auto listItr = oldScopes.begin();
-	while (listItr != oldScopes.end())
+	auto listItr = scopes.begin();
+	while (listItr != scopes.end())
 	{
 		auto hashtableItr = (*listItr)->begin();
 		while (hashtableItr != (*listItr)->end())
@@ -68,6 +74,15 @@ void SymbolTable::leaveScope()
 	activeScopes.pop_back();
 }
 
+/* Hand the scopes closed so far over to the caller, who deletes them once
+their symbols are no longer used. */
+OldScopes *SymbolTable::releaseOldScopes()
+{
+	OldScopes *released = new OldScopes;
+	released->scopes.splice(released->scopes.end(), oldScopes);
+	return released;
+}
+
 /* Simply insert next symbol into hash table. */
 void SymbolTable::insert(Symbol *newSymbol)
 {
@@ -88,7 +103,8 @@ Symbol * SymbolTable::lookup(Symbol * symbol)
 }
 Symbol * SymbolTable::lookup(string &symbol)
 {
-    return lookup(new Symbol {.name = symbol});
+    Symbol key {.name = symbol};
+    return lookup(&key);
 }
 /* To find a symbol in the current scope, we try to find it in the 
 hash table. */
@@ -105,7 +121,8 @@ Symbol * SymbolTable::find(Symbol *	symbol)
 /* Another find method that takes just a string */
 Symbol * SymbolTable::find(string &symbol)
 {
-    auto hashtableItr = activeScopes.back()->find(new Symbol {.name = symbol});
+    Symbol key {.name = symbol};
+    auto hashtableItr = activeScopes.back()->find(&key);
     if (hashtableItr != activeScopes.back()->end())
         return *hashtableItr;
     else
@@ -129,7 +146,8 @@ Symbol * SymbolTable::findAll(Symbol * symbol)
 }
 Symbol * SymbolTable::findAll(string &symbol)
 {
-    return findAll(new Symbol {.name = symbol});
+    Symbol key {.name = symbol};
+    return findAll(&key);
 }
 
 /* Display all identifiers in all active scopes. */
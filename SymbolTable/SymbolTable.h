@@ -45,6 +45,16 @@ public:
 	}
 };
 
+/* Scopes that have been closed, handed out by SymbolTable::releaseOldScopes().
+Deleting them deletes their symbols. */
+class OldScopes
+{
+public:
+	list<unordered_set<Symbol *, SymbolHash, SymbolEqual> *> scopes;
+
+	~OldScopes();
+};
+
 class SymbolTable
 {
 private:
@@ -77,6 +87,7 @@ public:
 
 	void enterNewScope();
 	void leaveScope();
+	OldScopes *releaseOldScopes();
 
 	void insert(Symbol *newSymbol);
     Symbol *getStringLabel();
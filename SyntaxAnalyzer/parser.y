@@ -49,11 +49,17 @@ void yyerror(const char *s) {
 
 %%
 
-program : function_definition program
+/* left recursive, so that the parser stack does not grow with the number
+ * of functions */
+program : program function_definition
         |   /* epsilon */
 ;
 
 function_definition : type ID '(' parameter_list ')' compound_stmt 
+                                            {
+                                                exitFunction($2);
+                                                free((void *) $2);
+                                            }
 ;
 
 type : INT                                  {$$ = "int";}
@@ -73,7 +79,7 @@ parameter_list_addon : ',' type ID parameter_list_addon
 compound_stmt : '{'                         {enterBlock();}
               compound_stmt_prime '}'       {exitBlock();}
 
-compound_stmt_prime : statement compound_stmt_prime
+compound_stmt_prime : compound_stmt_prime statement
                      |   /* epsilon */
 ;
 
@@ -87,12 +93,18 @@ statement : var_decl
           | compound_stmt                   
 ;
 
-var_decl : type lvalue ';'              {   varDecl($1, $2);    }
+var_decl : type lvalue ';'              {
+                                            varDecl($1, $2);
+                                            free((void *) $2);
+                                        }
 ;
 
 assignment : assign_lval '=' expression ';' { genCodeAssignment($1, $3); }
 ;
-assign_lval : lvalue                    { $$ = createExpRecForSymbol($1); }
+assign_lval : lvalue                    {
+                                            $$ = createExpRecForSymbol($1);
+                                            free((void *) $1);
+                                        }
 ;
 
 expression : logical_or_expr        /* accept default action: $$ = $1 */
@@ -162,12 +174,15 @@ primary_expr : '(' expression ')'           {
 
 val_token : lvalue          {   
                                 $$ = createExpRecForSymbol($1);
+                                free((void *) $1);
                             }
           | NUMBER          {
                                 $$ = genCodeLitNum($1);
+                                free((void *) $1);
                             }
           | STRING          {
                                 $$ = genCodeLitStr($1);
+                                free((void *) $1);
                             }
 ;
 
@@ -178,9 +193,13 @@ if_stmt : IF '(' expression ')'     {
                                         $<str>$ = genBranchAndLabel($<str>5);
                                     }
         else_stmt                   {
-                                        char *label = new char[10];
+                                        char *label =
+                                            new char[strlen($<str>7) + 1];
                                         strcpy(label, $<str>7);
-                                        genLabelStmt(label);
+                                        genEndIf(label);
+                                        delete[] label;
+                                        delete[] $<str>5;
+                                        delete[] $<str>7;
                                     }
 ;
 else_stmt : ELSE statement
@@ -202,16 +221,18 @@ while_loop : WHILE                  {
 
 while_loop : while_keyword while_expr while_stmt
                                     {
-                                        genBranchAndLabel($1, $2); 
+                                        exitLoop($1, $2);
+                                        delete[] $1;
+                                        delete[] $2;
                                     } 
 ;
 
 while_keyword : WHILE               {
-                                        $$ = genLabelStmt();
+                                        $$ = enterLoop();
                                     }
 ;
 while_expr : '(' expression ')'     {
-                                        $$ = genBranchOnZero($2);
+                                        $$ = genLoopBranch($2);
                                     }
 ;
 while_stmt : statement
@@ -220,12 +241,14 @@ while_stmt : statement
 /* mid-action rules needed below to read items in the correct order */
 cin_stmt : CIN INOP lvalue                  {
                                                 genCodeCin($3);
+                                                free((void *) $3);
                                             }
            cin_stmt_prime ';'
 ;
 
 cin_stmt_prime : INOP lvalue                {
                                                 genCodeCin($2);
+                                                free((void *) $2);
                                             }
                  cin_stmt_prime
                |    /* epsilon */
@@ -274,12 +297,16 @@ arg_list_prime : ',' val_token arg_list_prime
 
 lvalue : ID
        | ID '[' NUMBER ']'      {
-                                    $$ = string(string($1) + "[" + 
-                                    $3 + "]").c_str();
+                                    $$ = strdup((string($1) + "[" +
+                                    $3 + "]").c_str());
+                                    free((void *) $1);
+                                    free((void *) $3);
                                 }
        | ID '[' ID ']'          {
-                                    $$ = string(string($1) + "[" +
-                                    $3 + "]").data();
+                                    $$ = strdup((string($1) + "[" +
+                                    $3 + "]").c_str());
+                                    free((void *) $1);
+                                    free((void *) $3);
                                 }
 ;
 
@@ -287,7 +314,7 @@ lvalue : ID
 
 const string rule_desc[] = {
     "0",
-    "<program> -> <func_def> <program>",
+    "<program> -> <program> <func_def>",
     "<program> -> epsilon",
     "<func_def> -> <type> ID ( <param_list> ) <compound_stmt>",
     "<type> -> int",
@@ -298,7 +325,7 @@ const string rule_desc[] = {
     "<param_list_addon> -> , <type> <lvalue> <param_list_addon>",
     "<param_list_addon> -> epsilon",
     "<compound_stmt> -> { <compound_stmt_prime> }",
-    "<compound_stmt_prime> -> <statement> <compound_stmt_prime>",
+    "<compound_stmt_prime> -> <compound_stmt_prime> <statement>",
     "<compound_stmt_prime> -> epsilon",
     "<statement> -> <var_decl>",
     "<statement> -> <assignment>",
@@ -365,13 +392,61 @@ void closeSourceFile();
 
 int main(int argc, char *argv[]) {
     extern int yylineno;
+    char *sourceFile = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--bounds-check") {
+            options.boundsCheck = true;
+        } else if (arg == "--profile-generate") {
+            startProfiling();
+        } else if (arg.compare(0, 14, "--profile-use=") == 0) {
+            options.profileUse = arg.substr(14);
+        } else if (arg.compare(0, 13, "--emit-stats=") == 0) {
+            options.statsFile = arg.substr(13);
+        } else if (arg == "--annotate-lines") {
+            options.annotateLines = true;
+        } else if (arg == "--no-cse") {
+            options.noCse = true;
+        } else if (arg == "--stream") {
+            options.stream = true;
+        } else if (arg[0] == '-') {
+            cout << "cmm: error: unknown option: " << arg << "\n";
+            return -1;
+        } else {
+            sourceFile = argv[i];
+        }
+    }
 
-    if (argc < 2) {
+    if (!sourceFile) {
         cout << "cmm: error: no input files\n";
         return -1;
     }
 
-    if (openSourceFile(argv[1]) != 0) {
+    if (options.profileGenerate && !options.profileUse.empty()) {
+        cout << "cmm: error: --profile-generate and --profile-use "
+                "cannot be combined\n";
+        return -1;
+    }
+
+    if (!options.profileUse.empty() && !loadProfile(options.profileUse)) {
+        cout << "cmm: error: unable to read profile: "
+             << options.profileUse << "\n";
+        return -1;
+    }
+
+    if (!options.statsFile.empty()
+            && !startStats(options.statsFile, sourceFile)) {
+        cout << "cmm: error: unable to write statistics: "
+             << options.statsFile << "\n";
+        return -1;
+    }
+    if (options.annotateLines)
+        annotateLines();
+    if (options.stream)
+        startStreaming();
+
+    if (openSourceFile(sourceFile) != 0) {
         cout << "cmm: error: unable to open source file\n";
         return -2;
     }
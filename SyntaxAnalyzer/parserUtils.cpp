@@ -5,22 +5,55 @@
 #include <regex>
 #include "../SymbolTable/SymbolTable.h"
 #include "../CodeGenerator/CodeGenerator.h"
+#include "../RangeAnalysis/RangeAnalysis.h"
+#include "../Profile/Profile.h"
+#include "../ValueNumbering/ValueNumbering.h"
 #include "parserUtils.h"
 using namespace std;
 
 void extractArrayInfo(string &, int &, string &);
 bool isArray(string);
 string genCodeAddSPAndOffset(int loc);
+int typeSize(char type);
+string loadOp(char type);
+string storeOp(char type);
+void fillBoundsChecks(RangeAnalysis &, FunctionCode &);
 
 #define VERBOSE 0
 
-CodeGenerator CG("mips_code.s");
 SymbolTable symbolTable;
+CodeGenerator CG("mips_code.s");
+RangeAnalysis rangeAnalysis;
+ValueNumbering valueNumbering;
+Profile profile;
+Options options;
+
+/* statistics of the function being parsed, for --emit-stats */
+FunctionStats functionStats;
+int functionOffset = CG.getCurrOffset();    // where the function began
+
+/* Layout of the if and while statements being generated when a profile is
+ * used (--profile-use).  The rarely executed side of an if is moved out of
+ * line, and loops that usually iterate more than once are rotated so that
+ * the test is at the bottom. */
+struct IfLayout {
+    string elseLabel;
+    bool elseIsCold;
+};
+struct LoopLayout {
+    string head;
+    bool rotated;
+    CodeFragment condition;     // code of a rotated loop's test
+    string conditionLoad;       // loads the test's value into $t0
+};
+vector<IfLayout> ifLayouts;
+vector<LoopLayout> loopLayouts;
 
 /* helper function for generating unique labels for if and while statements */
 char *newLabel() {
     static int counter = 0;
-    char *label = new char[10];
+    /* room for "label", the digits of any int and the null character */
+    char *label = new char[sizeof "label" + 11];
 
     /* sprintf appends terminating null character */
     sprintf(label, "%s%d", "label", counter);
@@ -29,35 +62,121 @@ char *newLabel() {
     return label;
 }
 
+/* --profile-generate: the program prints its label counts at exit */
+void startProfiling() {
+    options.profileGenerate = true;
+    CG.enableProfiling();
+}
+/* emit a label; with --profile-generate, count how often it is reached */
+void genLabel(string label) {
+    /* other paths join here: values computed before are not available */
+    valueNumbering.clear();
+
+    CG.genCode(label + ":");
+    if (options.profileGenerate)
+        CG.genProfileCounter(label);
+}
 /* if_stmt : IF '(' expression ')' statement */
 char *genBranchOnZero(ExpressionRecord *er) {
     char *label = newLabel();
 
-    CG.genCode("lw $t0, " + to_string(er->loc) + "($sp)");
-    CG.genCode(string("beqz $t0, ") + label);
+    CG.genCode(loadOp(er->type) + " $t0, " + to_string(er->loc) + "($sp)");
+    if (profile.isLoaded()) {
+        /* which way to branch is decided once the then part is known */
+        ifLayouts.push_back(IfLayout {label, false});
+        CG.startFragment();
+    } else {
+        CG.genCode(string("beqz $t0, ") + label);
+    }
+
+    /* the statement that follows is guarded by the condition */
+    rangeAnalysis.enterGuard(er->range);
+    delete er;
 
     return label;
 }
 /* used to generate unconditional branch at end of while loop and label
  * for end of while loop */
 void genBranchAndLabel(string branchToLabel, string label) {
+    rangeAnalysis.leaveGuard();
     CG.genCode(string("b ") + branchToLabel);
-    CG.genCode(label + ":");
+    genLabel(label);
 }
 /* used to generate unconditional branch out of if stmt and label
- * for the else block; also used for while loop */
+ * for the else block */
 char *genBranchAndLabel(string label) {
+    if (profile.isLoaded())
+        return genProfiledElse(label);
+
+    rangeAnalysis.leaveGuard();
     char *newLabelStr = newLabel();
     CG.genCode(string("b ") + newLabelStr);
-    CG.genCode(label + ":");
+    genLabel(label);
 
     return newLabelStr;
 }
+/* Counterpart of genBranchAndLabel(label) when a profile is used.  The
+ * label after the if is reached by both sides, the else label only by
+ * the false side; the colder side goes out of line and branches back. */
+char *genProfiledElse(string label) {
+    rangeAnalysis.leaveGuard();
+    CodeFragment thenPart = CG.endFragment();
+    char *endLabel = newLabel();
+    IfLayout &layout = ifLayouts.back();
+
+    long elseCount = profile.count(label);
+    long thenCount = profile.count(endLabel) - elseCount;
+
+    if (elseCount > thenCount) {
+        /* invert the branch: the else part falls through */
+        CG.genCode("bnez $t0, " + label + "_then");
+
+        CG.startFragment();
+        CG.genCode(label + "_then:");
+        CG.genFragment(thenPart);
+        CG.genCode(string("b ") + endLabel);
+        CG.genColdFragment(CG.endFragment());
+
+        genLabel(label);
+    } else {
+        /* the then part falls through; the else part is collected */
+        CG.genCode("beqz $t0, " + label);
+        CG.genFragment(thenPart);
+        layout.elseIsCold = true;
+        CG.startFragment();
+
+        /* no label separates the else part from the then part here, but
+         * only the false side reaches it */
+        valueNumbering.clear();
+    }
+
+    return endLabel;
+}
+/* if_stmt : ... else_stmt; label is the one after the whole if */
+void genEndIf(char *label) {
+    if (profile.isLoaded()) {
+        IfLayout layout = ifLayouts.back();
+        ifLayouts.pop_back();
+
+        if (layout.elseIsCold) {
+            CodeFragment elsePart = CG.endFragment();
+            if (elsePart.empty()) {
+                /* no else part: the false side just skips the then part */
+                genLabel(layout.elseLabel);
+            } else {
+                CG.startFragment();
+                CG.genCode(layout.elseLabel + ":");
+                CG.genFragment(elsePart);
+                CG.genCode(string("b ") + label);
+                CG.genColdFragment(CG.endFragment());
+            }
+        }
+    }
+
+    genLabelStmt(label);
+}
 char *genLabelStmt(char *label) {
-    char *newLabel = new char[10];
-    strcpy(newLabel, label);
-    strncat(newLabel, ":", 1);
-    CG.genCode(newLabel);
+    genLabel(label);
     return label;
 }
 char *genLabelStmt() {
@@ -94,8 +213,8 @@ void genCodeExprOP(ExpressionRecord *er1, ExpressionRecord *er2,
     else
         loc2 = to_string(er2->loc) + "($sp)";
 
-    CG.genCode("lw $t1, " + loc1);
-    CG.genCode("lw $t2, " + loc2);
+    CG.genCode(loadOp(er1->type) + " $t1, " + loc1);
+    CG.genCode(loadOp(er2->type) + " $t2, " + loc2);
     switch(op) {
         case '<':   CG.genCode("slt $t0, $t1, $t2");
                     break;
@@ -126,9 +245,18 @@ ExpressionRecord *genCodeExpr(ExpressionRecord *er1,
             || (er2->type != 'i' && er2->type != 'c'))
         throw "arithmetic operand type must be int or char";
 
+    /* reuse the value if it has been computed in this block already */
+    string key = options.noCse ? "" : valueNumbering.exprKey(er1, er2, op);
+    if (ExpressionRecord *known = valueNumbering.find(key)) {
+        delete er1;
+        delete er2;
+        return known;
+    }
+
     /* get a temp symbol from the symbol table
      * the name is set by the symbol table, we set the type and loc */
     Symbol *tempSymbol = symbolTable.getTemp();
+    functionStats.temps++;
     tempSymbol->type = 'i';
     tempSymbol->loc = CG.getCurrOffsetAndUpdate();
 
@@ -136,7 +264,12 @@ ExpressionRecord *genCodeExpr(ExpressionRecord *er1,
 
     /* create an expression record for the temp symbol */
     ExpressionRecord *erForTemp = createExpRecForSymbol(tempSymbol->name);
+    erForTemp->range = ValueRange::combine(er1->range, er2->range, op);
 
+    valueNumbering.record(key, erForTemp);
+
+    delete er1;
+    delete er2;
     return erForTemp;
 }
 /* add $sp and offset to reach value in array where subscript is another id.
@@ -174,6 +307,10 @@ void genCodeCin(string symbol) {
         dest = to_string(expRec->loc) + "($sp)";
     }
 
+    /* the value read in could be anything */
+    rangeAnalysis.assign(expRec->range.var, ValueRange());
+    valueNumbering.assign(expRec->range.var);
+
     if (expRec->type == 'i') {
         CG.genCode("li $v0, 5");
         CG.genCode("syscall");
@@ -181,8 +318,9 @@ void genCodeCin(string symbol) {
     } else if (expRec->type == 'c') {
         CG.genCode("li $v0, 12");
         CG.genCode("syscall");
-        CG.genCode("sw $v0, " + dest);
+        CG.genCode("sb $v0, " + dest);
     }
+    delete expRec;
 }
 /* cout_mid : OUTOP ENDL cout_mid_prime */
 void genCodeEndl() {
@@ -196,7 +334,7 @@ void genCodeCout(ExpressionRecord *expRec) {
     if (expRec->isArrayWithSym) {
         // add $sp and offset to reach value in array
         dest = genCodeAddSPAndOffset(expRec->loc);
-        CG.genCode("lw $a0, " + dest);
+        CG.genCode(loadOp(expRec->type) + " $a0, " + dest);
         if (expRec->type == 'i')
             CG.genCode("li $v0, 1");
         else if (expRec->type == 'c')
@@ -207,7 +345,7 @@ void genCodeCout(ExpressionRecord *expRec) {
             CG.genCode("li $v0, 1");
 
         } else if (expRec->type == 'c') {
-            CG.genCode("lw $a0, " + to_string(expRec->loc) + "($sp)");
+            CG.genCode("lbu $a0, " + to_string(expRec->loc) + "($sp)");
             CG.genCode("li $v0, 11");
 
         } else if (expRec->type == 's') {
@@ -216,18 +354,16 @@ void genCodeCout(ExpressionRecord *expRec) {
         }
     }
     CG.genCode("syscall");
+    delete expRec;
 }
 /* assignment : lvalue '=' expression ';' */
 void genCodeAssignment(ExpressionRecord *er1, ExpressionRecord *er2) {
     if(VERBOSE) cout << "Assign stmt: " << er1->loc << " = " << er2->loc << endl;
     string loc1, loc2;
 
-    /* allow:  char_type = int_type; */
-    if (er1->type == 'c' && er2->type == 'i')
-        er2->type = 'c';
-
-    /* error if var type doesn't match expression type */
-    if (er1->type != er2->type) 
+    /* error if var type doesn't match expression type
+     * allow:  char_type = int_type; the value is truncated to a byte */
+    if (er1->type != er2->type && !(er1->type == 'c' && er2->type == 'i'))
         throw "assignment types do not match";
 
     /* if er1 (lvalue) is array with another symbol as a subscript */
@@ -245,8 +381,13 @@ void genCodeAssignment(ExpressionRecord *er1, ExpressionRecord *er2) {
     }
 
     /* copy value of expression into variable */
-    CG.genCode("lw $t1, " + loc2);
-    CG.genCode("sw $t1, " + loc1);
+    CG.genCode(loadOp(er2->type) + " $t1, " + loc2);
+    CG.genCode(storeOp(er1->type) + " $t1, " + loc1);
+
+    rangeAnalysis.assign(er1->range.var, er2->range);
+    valueNumbering.assign(er1->range.var);
+    delete er1;
+    delete er2;
 }
 /* val_token : STRING */
 ExpressionRecord *genCodeLitStr(string lexeme) {
@@ -255,18 +396,35 @@ ExpressionRecord *genCodeLitStr(string lexeme) {
 
     /* add static string to list of strings to be included in .data section */
     CG.addStaticString(expRec->locLabel, lexeme);
+    functionStats.strings++;
 
     return expRec;
 }
 /* val_token : NUMBER */
 ExpressionRecord *genCodeLitNum(string lexeme) {
+    ValueRange range;
+    try {
+        range = ValueRange::constant(stoi(lexeme));
+    } catch (out_of_range &ex) {
+        /* leave the range unknown */
+    }
+
+    /* reuse a slot that already holds the value in this block */
+    string key;
+    if (!options.noCse && range.isConst)
+        key = valueNumbering.constKey(range.value);
+    if (ExpressionRecord *known = valueNumbering.find(key))
+        return known;
+
     /* create expression record for integer */
     ExpressionRecord *expRec = createExpRec('i');
+    expRec->range = range;
 
     /* store value for integer on stack */
     CG.genCode("li $t0, " + lexeme);
     CG.genCode("sw $t0, " + to_string(expRec->loc) + "($sp)");
 
+    valueNumbering.record(key, expRec);
     return expRec;
 }
 ExpressionRecord *createExpRec(char type) {
@@ -294,7 +452,8 @@ ExpressionRecord *createExpRecForSymbol(string symbolName) {
     /* if var is array, extract name and index */
     int index = 0;
     string idIndex;
-    if (isArray(symbolName)) {
+    bool isElement = isArray(symbolName);
+    if (isElement) {
         extractArrayInfo(symbolName, index, idIndex);
     }
 
@@ -310,6 +469,7 @@ ExpressionRecord *createExpRecForSymbol(string symbolName) {
 
     ExpressionRecord *expRec = new ExpressionRecord;
     expRec->type = symbol->type;
+    expRec->range = ValueRange::variable(symbol, isElement);
 
     if (index == -1) {
         /* symbol is array with another symbol as subscript.
@@ -317,26 +477,47 @@ ExpressionRecord *createExpRecForSymbol(string symbolName) {
          */
         expRec->isArrayWithSym = true;
 
+        /* the address may have been computed in this block already */
+        string key = options.noCse ? ""
+                     : valueNumbering.addressKey(symbol, indexSym);
+        if (ExpressionRecord *known = valueNumbering.find(key)) {
+            delete expRec;
+            return known;
+        }
+
         Symbol *tempSymbol = symbolTable.getTemp();
+        functionStats.temps++;
         tempSymbol->loc = CG.getCurrOffsetAndUpdate();
         expRec->loc = tempSymbol->loc;
 
         // load value of index symbol
-        CG.genCode("lw $t0, " + to_string(indexSym->loc) + "($sp)");
-        // multiply by 4 (by doubling twice)
-        CG.genCode("add $t0, $t0, $t0");
-        CG.genCode("add $t0, $t0, $t0");
+        CG.genCode(loadOp(indexSym->type) + " $t0, "
+                   + to_string(indexSym->loc) + "($sp)");
+        // the bounds check goes here, unless it turns out to be redundant
+        if (options.boundsCheck)
+            rangeAnalysis.addCheck(CG.genPlaceholder(), symbol, indexSym);
+        // multiply by 4 (by doubling twice) for int elements
+        if (typeSize(symbol->type) == 4) {
+            CG.genCode("add $t0, $t0, $t0");
+            CG.genCode("add $t0, $t0, $t0");
+        }
         // now subtract above offset from offset of array
         CG.genCode("li $t1, " + to_string(symbol->loc));
         CG.genCode("sub $t0, $t1, $t0");
         // store final address to array elem in temp variable's location
         CG.genCode("sw $t0, " + to_string(tempSymbol->loc) + "($sp)");
+
+        valueNumbering.record(key, expRec);
     } else {
         /* otherwise, symbol is not an array or
          * it is an array with a literal number as subscript
          */
+        if (options.boundsCheck && isElement && index >= symbol->size)
+            throw "array index out of bounds: " + symbolName
+                  + "[" + to_string(index) + "]";
+
         expRec->isArrayWithSym = false;
-        expRec->loc = symbol->loc - index * 4;
+        expRec->loc = symbol->loc - index * typeSize(symbol->type);
     }
     return expRec;
 }
@@ -376,13 +557,24 @@ void extractArrayInfo(string &name, int &index, string &idIndex) {
 bool isArray(string symbol) {
     return symbol.find('[') != string::npos;
 }
+/* chars take a byte on the stack, ints a word */
+int typeSize(char type) {
+    return type == 'c' ? 1 : 4;
+}
+/* instructions to load and store a value of type; chars are unsigned */
+string loadOp(char type) {
+    return type == 'c' ? "lbu" : "lw";
+}
+string storeOp(char type) {
+    return type == 'c' ? "sb" : "sw";
+}
 /* var_decl : type lvalue ';' */
 void varDecl(string type, string name) {
     /* only variables of type int or char are allowed */
     if (type != "int" && type != "char")
         throw "invalid type in variable declaration: " + type;
 
-    // size of variable (in terms of # of words on stack)
+    // size of variable (in terms of # of elements on stack)
     int size = 1;
 
     // is it an array declaration?
@@ -418,7 +610,7 @@ void varDecl(string type, string name) {
     Symbol *newSymbol = new Symbol;
     newSymbol->name = name;
     newSymbol->type = type[0];
-    newSymbol->loc = CG.getCurrOffsetAndUpdate(size);
+    newSymbol->loc = CG.getCurrOffsetAndUpdate(size, typeSize(type[0]));
     if (size > 0)
         newSymbol->size = size;
 
@@ -441,3 +633,127 @@ void exitBlock() {
 void enterBlock() {
     symbolTable.enterNewScope();
 }
+/* while_keyword : WHILE
+ * returns the label at the head of the loop */
+char *enterLoop() {
+    rangeAnalysis.enterLoop();
+
+    /* with a profile, hold back the test until it is known where it goes */
+    if (profile.isLoaded())
+        CG.startFragment();
+
+    char *head = genLabelStmt();
+    loopLayouts.push_back(LoopLayout {head, false, CodeFragment(), ""});
+    return head;
+}
+/* while_expr : '(' expression ')'
+ * returns the label after the loop */
+char *genLoopBranch(ExpressionRecord *er) {
+    LoopLayout &layout = loopLayouts.back();
+    char *label = newLabel();
+
+    if (profile.isLoaded()) {
+        CodeFragment condition = CG.endFragment();
+
+        /* rotate loops that iterate more than once per entry on average */
+        long entries = profile.count(label);
+        long iterations = profile.count(layout.head) - entries;
+
+        if (iterations > entries) {
+            layout.rotated = true;
+            layout.condition = condition;
+            layout.conditionLoad = loadOp(er->type) + " $t0, "
+                                   + to_string(er->loc) + "($sp)";
+
+            CG.genCode("b " + layout.head);
+            CG.genCode(layout.head + "_body:");
+            rangeAnalysis.enterGuard(er->range);
+            delete er;
+            return label;
+        }
+        CG.genFragment(condition);
+    }
+
+    CG.genCode(loadOp(er->type) + " $t0, " + to_string(er->loc) + "($sp)");
+    CG.genCode(string("beqz $t0, ") + label);
+    rangeAnalysis.enterGuard(er->range);
+    delete er;
+
+    return label;
+}
+/* while_loop : while_keyword while_expr while_stmt */
+void exitLoop(string head, string label) {
+    LoopLayout layout = loopLayouts.back();
+    loopLayouts.pop_back();
+
+    if (layout.rotated) {
+        /* the test follows the body and branches back to it */
+        rangeAnalysis.leaveGuard();
+        CG.genFragment(layout.condition);
+        CG.genCode(layout.conditionLoad);
+        CG.genCode("bnez $t0, " + layout.head + "_body");
+        genLabel(label);
+    } else {
+        genBranchAndLabel(head, label);
+    }
+
+    rangeAnalysis.leaveLoop();
+}
+/* read the profile given with --profile-use */
+bool loadProfile(string filename) {
+    return profile.load(filename);
+}
+/* function_definition : type ID '(' parameter_list ')' compound_stmt
+ * the whole function has been seen: settle its bounds checks and write
+ * out its code */
+void exitFunction(string name) {
+    FunctionStats stats = functionStats;
+    stats.name = name;
+    stats.frameBytes = functionOffset - CG.getCurrOffset();
+    functionStats = FunctionStats();
+    functionOffset = CG.getCurrOffset();
+
+    CG.flush([&stats](FunctionCode &code) {
+        fillBoundsChecks(rangeAnalysis, code);
+        code.stats = stats;
+    });
+
+    rangeAnalysis.reset();
+    valueNumbering.reset();
+
+    /* with --stream, the symbols of the function are deleted with it */
+    if (options.stream)
+        delete symbolTable.releaseOldScopes();
+}
+/* settle the bounds checks of a function */
+void fillBoundsChecks(RangeAnalysis &analysis, FunctionCode &code) {
+    for (BoundsCheck check : analysis.resolve()) {
+        string access = check.array->name + "[" + check.index->name + "]";
+        if (check.redundant) {
+            code.fillPlaceholder(check.slot,
+                    "# bounds check on " + access + " eliminated");
+        } else {
+            code.fillPlaceholder(check.slot,
+                    "li $t1, " + to_string(check.array->size) + "\n"
+                    + "bgeu $t0, $t1, BoundsError");
+            code.requestBoundsHandler();
+        }
+    }
+}
+/* --emit-stats=FILE: write statistics about the code of source to FILE;
+ * false if FILE cannot be written */
+bool startStats(string filename, string source) {
+    extern int yylineno;
+    CG.trackLines(&yylineno);
+    return CG.enableStatistics(filename, source);
+}
+/* --annotate-lines: mark the code of each source line with "# line N" */
+void annotateLines() {
+    extern int yylineno;
+    CG.trackLines(&yylineno);
+    CG.enableLineAnnotations();
+}
+/* --stream: keep memory use proportional to the largest function */
+void startStreaming() {
+    CG.enableStreaming();
+}
@@ -1,17 +1,36 @@
 #include <string>
+#include "../RangeAnalysis/RangeAnalysis.h"
 using namespace std;
 
+/* Describes where the value of an expression is.  A record passed to one
+ * of the genCode functions below is deleted by it. */
 struct ExpressionRecord {
     char type;
     int loc;
     string locLabel;
     bool isArrayWithSym;
+    ValueRange range;
 };
 
+/* command line options, set by main() before parsing starts */
+struct Options {
+    bool boundsCheck;       // --bounds-check
+    bool profileGenerate;   // --profile-generate
+    string profileUse;      // --profile-use=FILE
+    string statsFile;       // --emit-stats=FILE
+    bool annotateLines;     // --annotate-lines
+    bool noCse;             // --no-cse
+    bool stream;            // --stream
+};
+extern Options options;
+
 char *newLabel();
+void genLabel(string label);
 char *genBranchOnZero(ExpressionRecord *er);
 void genBranchAndLabel(string branchToLabel, string label);
 char *genBranchAndLabel(string label);
+char *genProfiledElse(string label);
+void genEndIf(char *label);
 char *genLabelStmt(char *label);
 char *genLabelStmt();
 ExpressionRecord *genCodeExpr(ExpressionRecord *, ExpressionRecord *, char);
@@ -27,3 +46,12 @@ ExpressionRecord *createExpRecForSymbol(string symbol);
 void varDecl(string type, string name);
 void exitBlock();
 void enterBlock();
+char *enterLoop();
+char *genLoopBranch(ExpressionRecord *er);
+void exitLoop(string head, string label);
+void startProfiling();
+bool loadProfile(string filename);
+void exitFunction(string name);
+bool startStats(string filename, string source);
+void annotateLines();
+void startStreaming();
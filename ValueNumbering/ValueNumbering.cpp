@@ -0,0 +1,88 @@
+/*
+ * ValueNumbering.cpp
+ */
+
+#include <sstream>
+#include "ValueNumbering.h"
+#include "../SyntaxAnalyzer/parserUtils.h"
+using namespace std;
+
+/* the symbol's identity and how often it has been assigned */
+string ValueNumbering::version(Symbol *symbol) {
+    ostringstream key;
+    key << (void *) symbol << '.' << versions[symbol];
+    return key.str();
+}
+/* key for the value of an operand; empty if it cannot be numbered */
+string ValueNumbering::operandKey(ExpressionRecord *er) {
+    /* results of expressions and literals have stack slots of their own,
+     * written once; a literal's slot is shared by every use of it in the
+     * block, so equal literals give equal keys */
+    Symbol *var = er->range.var;
+    if (!var)
+        return er->type == 'i' || er->type == 'c'
+               ? "@" + to_string(er->loc) : "";
+
+    /* an element of the array at an address held in a temp, or at a fixed
+     * offset */
+    if (er->isArrayWithSym)
+        return "*" + version(var) + "@" + to_string(er->loc);
+    if (er->range.isElement)
+        return version(var) + "@" + to_string(er->loc);
+    return version(var);
+}
+/* key for (er1 op er2); empty if it cannot be numbered */
+string ValueNumbering::exprKey(ExpressionRecord *er1, ExpressionRecord *er2,
+                               char op) {
+    string key1 = operandKey(er1);
+    string key2 = operandKey(er2);
+    if (key1.empty() || key2.empty())
+        return "";
+
+    /* operand order does not matter for these */
+    if ((op == '+' || op == '*' || op == '=' || op == '|' || op == '&')
+            && key2 < key1)
+        swap(key1, key2);
+
+    return "(" + key1 + " " + op + " " + key2 + ")";
+}
+/* key for the slot genCodeLitNum() stored the literal value to */
+string ValueNumbering::constKey(int value) {
+    return "#" + to_string(value);
+}
+/* key for the address of array[index] */
+string ValueNumbering::addressKey(Symbol *array, Symbol *index) {
+    ostringstream key;
+    key << "&" << (void *) array << "[" << version(index) << "]";
+    return key.str();
+}
+/* a copy of the record of an available value, or nullptr; callers may
+ * change the records they are given, so the table keeps its own */
+ExpressionRecord *ValueNumbering::find(const string &key) {
+    if (key.empty())
+        return nullptr;
+
+    auto itr = available.find(key);
+    if (itr == available.end())
+        return nullptr;
+    return new ExpressionRecord(*itr->second);
+}
+void ValueNumbering::record(const string &key, ExpressionRecord *er) {
+    if (!key.empty() && !available.count(key))
+        available[key] = new ExpressionRecord(*er);
+}
+/* the variable (or an element of the array) target was stored to */
+void ValueNumbering::assign(Symbol *target) {
+    versions[target]++;
+}
+/* a label starts a new basic block */
+void ValueNumbering::clear() {
+    for (auto entry : available)
+        delete entry.second;
+    available.clear();
+}
+/* a function is complete; its symbols may be deleted */
+void ValueNumbering::reset() {
+    clear();
+    versions.clear();
+}
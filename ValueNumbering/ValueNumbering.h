@@ -0,0 +1,39 @@
+/*
+ * ValueNumbering.h
+ */
+
+#pragma once
+#include <string>
+#include <unordered_map>
+#include "../SymbolTable/SymbolTable.h"
+using namespace std;
+
+struct ExpressionRecord;
+
+/* Local value numbering.  Within a basic block, a value that has already
+ * been computed into a stack slot is looked up by a key describing how it
+ * was computed, and the slot is reused instead of computing it again.
+ *
+ * Keys name variables together with a version that every store to the
+ * variable (or to any element of the array) bumps, so an intervening
+ * assignment or cin makes the old values unreachable.  Stack slots are
+ * written only once, which keeps the values of older versions intact.
+ * The table is cleared at every label, where other paths join in. */
+class ValueNumbering {
+    private:
+        unordered_map<Symbol *, int> versions;
+        unordered_map<string, ExpressionRecord *> available;
+
+        string version(Symbol *);
+
+    public:
+        string operandKey(ExpressionRecord *er);
+        string exprKey(ExpressionRecord *er1, ExpressionRecord *er2, char op);
+        string constKey(int value);
+        string addressKey(Symbol *array, Symbol *index);
+        ExpressionRecord *find(const string &key);
+        void record(const string &key, ExpressionRecord *er);
+        void assign(Symbol *target);
+        void clear();
+        void reset();
+};
@@ -106,17 +106,17 @@ li $a0, '\n'
 li $v0, 11
 syscall
 li $t0, 121
-sw $t0, -80($sp)
-lw $t1, -80($sp)
-sw $t1, -76($sp)
+sw $t0, -76($sp)
+lw $t1, -76($sp)
+sb $t1, -70($sp)
 label0:
 li $t0, 121
-sw $t0, -84($sp)
-lw $t1, -76($sp)
-lw $t2, -84($sp)
+sw $t0, -80($sp)
+lbu $t1, -70($sp)
+lw $t2, -80($sp)
 seq $t0, $t1, $t2
-sw $t0, -88($sp)
-lw $t0, -88($sp)
+sw $t0, -84($sp)
+lw $t0, -84($sp)
 beqz $t0, label1
 li $a0, '\n'
 li $v0, 11
@@ -129,23 +129,23 @@ syscall
 sw $v0, -64($sp)
 li $v0, 12
 syscall
-sw $v0, -72($sp)
+sb $v0, -69($sp)
 li $v0, 5
 syscall
 sw $v0, -68($sp)
 li $t0, 43
-sw $t0, -92($sp)
-lw $t1, -72($sp)
-lw $t2, -92($sp)
+sw $t0, -88($sp)
+lbu $t1, -69($sp)
+lw $t2, -88($sp)
 seq $t0, $t1, $t2
-sw $t0, -96($sp)
-lw $t0, -96($sp)
+sw $t0, -92($sp)
+lw $t0, -92($sp)
 beqz $t0, label2
 lw $t1, -64($sp)
 lw $t2, -68($sp)
 add $t0, $t1, $t2
-sw $t0, -100($sp)
-lw $t1, -100($sp)
+sw $t0, -96($sp)
+lw $t1, -96($sp)
 sw $t1, -64($sp)
 la $a0, str_17
 li $v0, 4
@@ -162,18 +162,18 @@ syscall
 b label3
 label2:
 li $t0, 45
-sw $t0, -104($sp)
-lw $t1, -72($sp)
-lw $t2, -104($sp)
+sw $t0, -100($sp)
+lbu $t1, -69($sp)
+lw $t2, -100($sp)
 seq $t0, $t1, $t2
-sw $t0, -108($sp)
-lw $t0, -108($sp)
+sw $t0, -104($sp)
+lw $t0, -104($sp)
 beqz $t0, label4
 lw $t1, -64($sp)
 lw $t2, -68($sp)
 sub $t0, $t1, $t2
-sw $t0, -112($sp)
-lw $t1, -112($sp)
+sw $t0, -108($sp)
+lw $t1, -108($sp)
 sw $t1, -64($sp)
 la $a0, str_20
 li $v0, 4
@@ -190,19 +190,19 @@ syscall
 b label5
 label4:
 li $t0, 42
-sw $t0, -116($sp)
-lw $t1, -72($sp)
-lw $t2, -116($sp)
+sw $t0, -112($sp)
+lbu $t1, -69($sp)
+lw $t2, -112($sp)
 seq $t0, $t1, $t2
-sw $t0, -120($sp)
-lw $t0, -120($sp)
+sw $t0, -116($sp)
+lw $t0, -116($sp)
 beqz $t0, label6
 lw $t1, -64($sp)
 lw $t2, -68($sp)
 mult $t1, $t2
 mflo $t0
-sw $t0, -124($sp)
-lw $t1, -124($sp)
+sw $t0, -120($sp)
+lw $t1, -120($sp)
 sw $t1, -64($sp)
 la $a0, str_23
 li $v0, 4
@@ -219,19 +219,19 @@ syscall
 b label7
 label6:
 li $t0, 47
-sw $t0, -128($sp)
-lw $t1, -72($sp)
-lw $t2, -128($sp)
+sw $t0, -124($sp)
+lbu $t1, -69($sp)
+lw $t2, -124($sp)
 seq $t0, $t1, $t2
-sw $t0, -132($sp)
-lw $t0, -132($sp)
+sw $t0, -128($sp)
+lw $t0, -128($sp)
 beqz $t0, label8
 lw $t1, -64($sp)
 lw $t2, -68($sp)
 div $t1, $t2
 mflo $t0
-sw $t0, -136($sp)
-lw $t1, -136($sp)
+sw $t0, -132($sp)
+lw $t1, -132($sp)
 sw $t1, -64($sp)
 la $a0, str_26
 li $v0, 4
@@ -265,7 +265,7 @@ li $v0, 4
 syscall
 li $v0, 12
 syscall
-sw $v0, -76($sp)
+sb $v0, -70($sp)
 li $a0, '\n'
 li $v0, 11
 syscall
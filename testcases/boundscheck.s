@@ -0,0 +1,195 @@
+# Prolog:
+.text
+main:
+move $fp $sp
+la $a0 ProgStart
+li $v0 4
+syscall
+# End of Prolog
+
+li $t0, 10
+sw $t0, -60($sp)
+lw $t1, -60($sp)
+sw $t1, -44($sp)
+li $t0, 0
+sw $t0, -64($sp)
+lw $t1, -64($sp)
+sw $t1, -40($sp)
+label0:
+lw $t1, -40($sp)
+lw $t2, -44($sp)
+slt $t0, $t1, $t2
+sw $t0, -68($sp)
+lw $t0, -68($sp)
+beqz $t0, label1
+lw $t0, -40($sp)
+# bounds check on nums[i] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -72($sp)
+lw $t1, -40($sp)
+lw $t2, -40($sp)
+mult $t1, $t2
+mflo $t0
+sw $t0, -76($sp)
+move $t0, $sp
+lw $t1, -72($sp)
+add $t3, $t0, $t1
+lw $t1, -76($sp)
+sw $t1, ($t3)
+li $t0, 1
+sw $t0, -80($sp)
+lw $t1, -40($sp)
+lw $t2, -80($sp)
+add $t0, $t1, $t2
+sw $t0, -84($sp)
+lw $t1, -84($sp)
+sw $t1, -40($sp)
+b label0
+label1:
+li $t0, 0
+sw $t0, -88($sp)
+lw $t1, -88($sp)
+sw $t1, -48($sp)
+lw $t1, -88($sp)
+sw $t1, -40($sp)
+label2:
+li $t0, 10
+sw $t0, -92($sp)
+lw $t1, -40($sp)
+lw $t2, -92($sp)
+slt $t0, $t1, $t2
+sw $t0, -96($sp)
+lw $t0, -96($sp)
+beqz $t0, label3
+lw $t0, -40($sp)
+# bounds check on nums[i] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -100($sp)
+move $t0, $sp
+lw $t1, -100($sp)
+add $t4, $t0, $t1
+lw $t1, -48($sp)
+lw $t2, ($t4)
+add $t0, $t1, $t2
+sw $t0, -104($sp)
+lw $t1, -104($sp)
+sw $t1, -48($sp)
+li $t0, 1
+sw $t0, -108($sp)
+lw $t1, -40($sp)
+lw $t2, -108($sp)
+add $t0, $t1, $t2
+sw $t0, -112($sp)
+lw $t1, -112($sp)
+sw $t1, -40($sp)
+b label2
+label3:
+la $a0, str_8
+li $v0, 4
+syscall
+lw $a0, -48($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+la $a0, str_9
+li $v0, 4
+syscall
+li $v0, 5
+syscall
+sw $v0, -52($sp)
+lw $t0, -52($sp)
+li $t1, 10
+bgeu $t0, $t1, BoundsError
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -116($sp)
+move $t0, $sp
+lw $t1, -116($sp)
+add $t5, $t0, $t1
+lw $a0, ($t5)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+li $t0, 2147483647
+sw $t0, -120($sp)
+lw $t1, -120($sp)
+sw $t1, -56($sp)
+li $t0, 2
+sw $t0, -124($sp)
+lw $t1, -56($sp)
+lw $t2, -124($sp)
+mult $t1, $t2
+mflo $t0
+sw $t0, -128($sp)
+li $t0, 1
+sw $t0, -132($sp)
+lw $t1, -128($sp)
+lw $t2, -132($sp)
+add $t0, $t1, $t2
+sw $t0, -136($sp)
+lw $t1, -136($sp)
+sw $t1, -56($sp)
+li $t0, 5
+sw $t0, -140($sp)
+lw $t1, -56($sp)
+lw $t2, -140($sp)
+slt $t0, $t1, $t2
+sw $t0, -144($sp)
+lw $t0, -144($sp)
+beqz $t0, label4
+lw $t0, -56($sp)
+li $t1, 10
+bgeu $t0, $t1, BoundsError
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -148($sp)
+li $t0, 0
+sw $t0, -152($sp)
+move $t0, $sp
+lw $t1, -148($sp)
+add $t6, $t0, $t1
+lw $t1, -152($sp)
+sw $t1, ($t6)
+b label5
+label4:
+label5:
+la $a0, str_15
+li $v0, 4
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+
+# Postlog:
+la $a0 ProgEnd
+li $v0 4
+syscall
+li $v0 10
+syscall
+BoundsError:
+la $a0 BoundsMsg
+li $v0 4
+syscall
+li $v0 10
+syscall
+.data
+ProgStart: 	 .asciiz "Program Start\n"
+ProgEnd:   	 .asciiz "Program End\n"
+BoundsMsg: 	 .asciiz "array index out of bounds\n"
+str_8: 		 .asciiz "sum: "
+str_9: 		 .asciiz "index: "
+str_15: 		 .asciiz "not reached"
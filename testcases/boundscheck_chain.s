@@ -0,0 +1,5568 @@
+# Prolog:
+.text
+main:
+move $fp $sp
+la $a0 ProgStart
+li $v0 4
+syscall
+# End of Prolog
+
+li $t0, 100
+sw $t0, -844($sp)
+lw $t1, -844($sp)
+sw $t1, -32($sp)
+li $t0, 8
+sw $t0, -848($sp)
+lw $t1, -32($sp)
+lw $t2, -848($sp)
+slt $t0, $t1, $t2
+sw $t0, -852($sp)
+lw $t0, -852($sp)
+beqz $t0, label0
+lw $t1, -32($sp)
+sw $t1, -36($sp)
+b label1
+label0:
+label1:
+lw $t0, -36($sp)
+# bounds check on a[v1] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -856($sp)
+li $t0, 1
+sw $t0, -860($sp)
+move $t0, $sp
+lw $t1, -856($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -860($sp)
+add $t0, $t1, $t2
+sw $t0, -864($sp)
+move $t0, $sp
+lw $t1, -856($sp)
+add $t4, $t0, $t1
+lw $t1, -864($sp)
+sw $t1, ($t4)
+lw $t1, -36($sp)
+sw $t1, -40($sp)
+lw $t0, -40($sp)
+# bounds check on a[v2] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -868($sp)
+move $t0, $sp
+lw $t1, -868($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -860($sp)
+add $t0, $t1, $t2
+sw $t0, -872($sp)
+move $t0, $sp
+lw $t1, -868($sp)
+add $t6, $t0, $t1
+lw $t1, -872($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -876($sp)
+lw $t1, -40($sp)
+lw $t2, -876($sp)
+slt $t0, $t1, $t2
+sw $t0, -880($sp)
+lw $t0, -880($sp)
+beqz $t0, label2
+lw $t1, -40($sp)
+sw $t1, -44($sp)
+b label3
+label2:
+label3:
+lw $t0, -44($sp)
+# bounds check on a[v3] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -884($sp)
+li $t0, 1
+sw $t0, -888($sp)
+move $t0, $sp
+lw $t1, -884($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -888($sp)
+add $t0, $t1, $t2
+sw $t0, -892($sp)
+move $t0, $sp
+lw $t1, -884($sp)
+add $t8, $t0, $t1
+lw $t1, -892($sp)
+sw $t1, ($t8)
+lw $t1, -44($sp)
+sw $t1, -48($sp)
+lw $t0, -48($sp)
+# bounds check on a[v4] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -896($sp)
+move $t0, $sp
+lw $t1, -896($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -888($sp)
+add $t0, $t1, $t2
+sw $t0, -900($sp)
+move $t0, $sp
+lw $t1, -896($sp)
+add $t3, $t0, $t1
+lw $t1, -900($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -904($sp)
+lw $t1, -48($sp)
+lw $t2, -904($sp)
+slt $t0, $t1, $t2
+sw $t0, -908($sp)
+lw $t0, -908($sp)
+beqz $t0, label4
+lw $t1, -48($sp)
+sw $t1, -52($sp)
+b label5
+label4:
+label5:
+lw $t0, -52($sp)
+# bounds check on a[v5] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -912($sp)
+li $t0, 1
+sw $t0, -916($sp)
+move $t0, $sp
+lw $t1, -912($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -916($sp)
+add $t0, $t1, $t2
+sw $t0, -920($sp)
+move $t0, $sp
+lw $t1, -912($sp)
+add $t5, $t0, $t1
+lw $t1, -920($sp)
+sw $t1, ($t5)
+lw $t1, -52($sp)
+sw $t1, -56($sp)
+lw $t0, -56($sp)
+# bounds check on a[v6] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -924($sp)
+move $t0, $sp
+lw $t1, -924($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -916($sp)
+add $t0, $t1, $t2
+sw $t0, -928($sp)
+move $t0, $sp
+lw $t1, -924($sp)
+add $t7, $t0, $t1
+lw $t1, -928($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -932($sp)
+lw $t1, -56($sp)
+lw $t2, -932($sp)
+slt $t0, $t1, $t2
+sw $t0, -936($sp)
+lw $t0, -936($sp)
+beqz $t0, label6
+lw $t1, -56($sp)
+sw $t1, -60($sp)
+b label7
+label6:
+label7:
+lw $t0, -60($sp)
+# bounds check on a[v7] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -940($sp)
+li $t0, 1
+sw $t0, -944($sp)
+move $t0, $sp
+lw $t1, -940($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -944($sp)
+add $t0, $t1, $t2
+sw $t0, -948($sp)
+move $t0, $sp
+lw $t1, -940($sp)
+add $t9, $t0, $t1
+lw $t1, -948($sp)
+sw $t1, ($t9)
+lw $t1, -60($sp)
+sw $t1, -64($sp)
+lw $t0, -64($sp)
+# bounds check on a[v8] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -952($sp)
+move $t0, $sp
+lw $t1, -952($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -944($sp)
+add $t0, $t1, $t2
+sw $t0, -956($sp)
+move $t0, $sp
+lw $t1, -952($sp)
+add $t4, $t0, $t1
+lw $t1, -956($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -960($sp)
+lw $t1, -64($sp)
+lw $t2, -960($sp)
+slt $t0, $t1, $t2
+sw $t0, -964($sp)
+lw $t0, -964($sp)
+beqz $t0, label8
+lw $t1, -64($sp)
+sw $t1, -68($sp)
+b label9
+label8:
+label9:
+lw $t0, -68($sp)
+# bounds check on a[v9] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -968($sp)
+li $t0, 1
+sw $t0, -972($sp)
+move $t0, $sp
+lw $t1, -968($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -972($sp)
+add $t0, $t1, $t2
+sw $t0, -976($sp)
+move $t0, $sp
+lw $t1, -968($sp)
+add $t6, $t0, $t1
+lw $t1, -976($sp)
+sw $t1, ($t6)
+lw $t1, -68($sp)
+sw $t1, -72($sp)
+lw $t0, -72($sp)
+# bounds check on a[v10] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -980($sp)
+move $t0, $sp
+lw $t1, -980($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -972($sp)
+add $t0, $t1, $t2
+sw $t0, -984($sp)
+move $t0, $sp
+lw $t1, -980($sp)
+add $t8, $t0, $t1
+lw $t1, -984($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -988($sp)
+lw $t1, -72($sp)
+lw $t2, -988($sp)
+slt $t0, $t1, $t2
+sw $t0, -992($sp)
+lw $t0, -992($sp)
+beqz $t0, label10
+lw $t1, -72($sp)
+sw $t1, -76($sp)
+b label11
+label10:
+label11:
+lw $t0, -76($sp)
+# bounds check on a[v11] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -996($sp)
+li $t0, 1
+sw $t0, -1000($sp)
+move $t0, $sp
+lw $t1, -996($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1000($sp)
+add $t0, $t1, $t2
+sw $t0, -1004($sp)
+move $t0, $sp
+lw $t1, -996($sp)
+add $t3, $t0, $t1
+lw $t1, -1004($sp)
+sw $t1, ($t3)
+lw $t1, -76($sp)
+sw $t1, -80($sp)
+lw $t0, -80($sp)
+# bounds check on a[v12] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1008($sp)
+move $t0, $sp
+lw $t1, -1008($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1000($sp)
+add $t0, $t1, $t2
+sw $t0, -1012($sp)
+move $t0, $sp
+lw $t1, -1008($sp)
+add $t5, $t0, $t1
+lw $t1, -1012($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -1016($sp)
+lw $t1, -80($sp)
+lw $t2, -1016($sp)
+slt $t0, $t1, $t2
+sw $t0, -1020($sp)
+lw $t0, -1020($sp)
+beqz $t0, label12
+lw $t1, -80($sp)
+sw $t1, -84($sp)
+b label13
+label12:
+label13:
+lw $t0, -84($sp)
+# bounds check on a[v13] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1024($sp)
+li $t0, 1
+sw $t0, -1028($sp)
+move $t0, $sp
+lw $t1, -1024($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1028($sp)
+add $t0, $t1, $t2
+sw $t0, -1032($sp)
+move $t0, $sp
+lw $t1, -1024($sp)
+add $t7, $t0, $t1
+lw $t1, -1032($sp)
+sw $t1, ($t7)
+lw $t1, -84($sp)
+sw $t1, -88($sp)
+lw $t0, -88($sp)
+# bounds check on a[v14] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1036($sp)
+move $t0, $sp
+lw $t1, -1036($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1028($sp)
+add $t0, $t1, $t2
+sw $t0, -1040($sp)
+move $t0, $sp
+lw $t1, -1036($sp)
+add $t9, $t0, $t1
+lw $t1, -1040($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -1044($sp)
+lw $t1, -88($sp)
+lw $t2, -1044($sp)
+slt $t0, $t1, $t2
+sw $t0, -1048($sp)
+lw $t0, -1048($sp)
+beqz $t0, label14
+lw $t1, -88($sp)
+sw $t1, -92($sp)
+b label15
+label14:
+label15:
+lw $t0, -92($sp)
+# bounds check on a[v15] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1052($sp)
+li $t0, 1
+sw $t0, -1056($sp)
+move $t0, $sp
+lw $t1, -1052($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1056($sp)
+add $t0, $t1, $t2
+sw $t0, -1060($sp)
+move $t0, $sp
+lw $t1, -1052($sp)
+add $t4, $t0, $t1
+lw $t1, -1060($sp)
+sw $t1, ($t4)
+lw $t1, -92($sp)
+sw $t1, -96($sp)
+lw $t0, -96($sp)
+# bounds check on a[v16] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1064($sp)
+move $t0, $sp
+lw $t1, -1064($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1056($sp)
+add $t0, $t1, $t2
+sw $t0, -1068($sp)
+move $t0, $sp
+lw $t1, -1064($sp)
+add $t6, $t0, $t1
+lw $t1, -1068($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -1072($sp)
+lw $t1, -96($sp)
+lw $t2, -1072($sp)
+slt $t0, $t1, $t2
+sw $t0, -1076($sp)
+lw $t0, -1076($sp)
+beqz $t0, label16
+lw $t1, -96($sp)
+sw $t1, -100($sp)
+b label17
+label16:
+label17:
+lw $t0, -100($sp)
+# bounds check on a[v17] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1080($sp)
+li $t0, 1
+sw $t0, -1084($sp)
+move $t0, $sp
+lw $t1, -1080($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1084($sp)
+add $t0, $t1, $t2
+sw $t0, -1088($sp)
+move $t0, $sp
+lw $t1, -1080($sp)
+add $t8, $t0, $t1
+lw $t1, -1088($sp)
+sw $t1, ($t8)
+lw $t1, -100($sp)
+sw $t1, -104($sp)
+lw $t0, -104($sp)
+# bounds check on a[v18] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1092($sp)
+move $t0, $sp
+lw $t1, -1092($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1084($sp)
+add $t0, $t1, $t2
+sw $t0, -1096($sp)
+move $t0, $sp
+lw $t1, -1092($sp)
+add $t3, $t0, $t1
+lw $t1, -1096($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -1100($sp)
+lw $t1, -104($sp)
+lw $t2, -1100($sp)
+slt $t0, $t1, $t2
+sw $t0, -1104($sp)
+lw $t0, -1104($sp)
+beqz $t0, label18
+lw $t1, -104($sp)
+sw $t1, -108($sp)
+b label19
+label18:
+label19:
+lw $t0, -108($sp)
+# bounds check on a[v19] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1108($sp)
+li $t0, 1
+sw $t0, -1112($sp)
+move $t0, $sp
+lw $t1, -1108($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1112($sp)
+add $t0, $t1, $t2
+sw $t0, -1116($sp)
+move $t0, $sp
+lw $t1, -1108($sp)
+add $t5, $t0, $t1
+lw $t1, -1116($sp)
+sw $t1, ($t5)
+lw $t1, -108($sp)
+sw $t1, -112($sp)
+lw $t0, -112($sp)
+# bounds check on a[v20] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1120($sp)
+move $t0, $sp
+lw $t1, -1120($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1112($sp)
+add $t0, $t1, $t2
+sw $t0, -1124($sp)
+move $t0, $sp
+lw $t1, -1120($sp)
+add $t7, $t0, $t1
+lw $t1, -1124($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -1128($sp)
+lw $t1, -112($sp)
+lw $t2, -1128($sp)
+slt $t0, $t1, $t2
+sw $t0, -1132($sp)
+lw $t0, -1132($sp)
+beqz $t0, label20
+lw $t1, -112($sp)
+sw $t1, -116($sp)
+b label21
+label20:
+label21:
+lw $t0, -116($sp)
+# bounds check on a[v21] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1136($sp)
+li $t0, 1
+sw $t0, -1140($sp)
+move $t0, $sp
+lw $t1, -1136($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1140($sp)
+add $t0, $t1, $t2
+sw $t0, -1144($sp)
+move $t0, $sp
+lw $t1, -1136($sp)
+add $t9, $t0, $t1
+lw $t1, -1144($sp)
+sw $t1, ($t9)
+lw $t1, -116($sp)
+sw $t1, -120($sp)
+lw $t0, -120($sp)
+# bounds check on a[v22] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1148($sp)
+move $t0, $sp
+lw $t1, -1148($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1140($sp)
+add $t0, $t1, $t2
+sw $t0, -1152($sp)
+move $t0, $sp
+lw $t1, -1148($sp)
+add $t4, $t0, $t1
+lw $t1, -1152($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -1156($sp)
+lw $t1, -120($sp)
+lw $t2, -1156($sp)
+slt $t0, $t1, $t2
+sw $t0, -1160($sp)
+lw $t0, -1160($sp)
+beqz $t0, label22
+lw $t1, -120($sp)
+sw $t1, -124($sp)
+b label23
+label22:
+label23:
+lw $t0, -124($sp)
+# bounds check on a[v23] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1164($sp)
+li $t0, 1
+sw $t0, -1168($sp)
+move $t0, $sp
+lw $t1, -1164($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1168($sp)
+add $t0, $t1, $t2
+sw $t0, -1172($sp)
+move $t0, $sp
+lw $t1, -1164($sp)
+add $t6, $t0, $t1
+lw $t1, -1172($sp)
+sw $t1, ($t6)
+lw $t1, -124($sp)
+sw $t1, -128($sp)
+lw $t0, -128($sp)
+# bounds check on a[v24] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1176($sp)
+move $t0, $sp
+lw $t1, -1176($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1168($sp)
+add $t0, $t1, $t2
+sw $t0, -1180($sp)
+move $t0, $sp
+lw $t1, -1176($sp)
+add $t8, $t0, $t1
+lw $t1, -1180($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -1184($sp)
+lw $t1, -128($sp)
+lw $t2, -1184($sp)
+slt $t0, $t1, $t2
+sw $t0, -1188($sp)
+lw $t0, -1188($sp)
+beqz $t0, label24
+lw $t1, -128($sp)
+sw $t1, -132($sp)
+b label25
+label24:
+label25:
+lw $t0, -132($sp)
+# bounds check on a[v25] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1192($sp)
+li $t0, 1
+sw $t0, -1196($sp)
+move $t0, $sp
+lw $t1, -1192($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1196($sp)
+add $t0, $t1, $t2
+sw $t0, -1200($sp)
+move $t0, $sp
+lw $t1, -1192($sp)
+add $t3, $t0, $t1
+lw $t1, -1200($sp)
+sw $t1, ($t3)
+lw $t1, -132($sp)
+sw $t1, -136($sp)
+lw $t0, -136($sp)
+# bounds check on a[v26] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1204($sp)
+move $t0, $sp
+lw $t1, -1204($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1196($sp)
+add $t0, $t1, $t2
+sw $t0, -1208($sp)
+move $t0, $sp
+lw $t1, -1204($sp)
+add $t5, $t0, $t1
+lw $t1, -1208($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -1212($sp)
+lw $t1, -136($sp)
+lw $t2, -1212($sp)
+slt $t0, $t1, $t2
+sw $t0, -1216($sp)
+lw $t0, -1216($sp)
+beqz $t0, label26
+lw $t1, -136($sp)
+sw $t1, -140($sp)
+b label27
+label26:
+label27:
+lw $t0, -140($sp)
+# bounds check on a[v27] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1220($sp)
+li $t0, 1
+sw $t0, -1224($sp)
+move $t0, $sp
+lw $t1, -1220($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1224($sp)
+add $t0, $t1, $t2
+sw $t0, -1228($sp)
+move $t0, $sp
+lw $t1, -1220($sp)
+add $t7, $t0, $t1
+lw $t1, -1228($sp)
+sw $t1, ($t7)
+lw $t1, -140($sp)
+sw $t1, -144($sp)
+lw $t0, -144($sp)
+# bounds check on a[v28] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1232($sp)
+move $t0, $sp
+lw $t1, -1232($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1224($sp)
+add $t0, $t1, $t2
+sw $t0, -1236($sp)
+move $t0, $sp
+lw $t1, -1232($sp)
+add $t9, $t0, $t1
+lw $t1, -1236($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -1240($sp)
+lw $t1, -144($sp)
+lw $t2, -1240($sp)
+slt $t0, $t1, $t2
+sw $t0, -1244($sp)
+lw $t0, -1244($sp)
+beqz $t0, label28
+lw $t1, -144($sp)
+sw $t1, -148($sp)
+b label29
+label28:
+label29:
+lw $t0, -148($sp)
+# bounds check on a[v29] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1248($sp)
+li $t0, 1
+sw $t0, -1252($sp)
+move $t0, $sp
+lw $t1, -1248($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1252($sp)
+add $t0, $t1, $t2
+sw $t0, -1256($sp)
+move $t0, $sp
+lw $t1, -1248($sp)
+add $t4, $t0, $t1
+lw $t1, -1256($sp)
+sw $t1, ($t4)
+lw $t1, -148($sp)
+sw $t1, -152($sp)
+lw $t0, -152($sp)
+# bounds check on a[v30] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1260($sp)
+move $t0, $sp
+lw $t1, -1260($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1252($sp)
+add $t0, $t1, $t2
+sw $t0, -1264($sp)
+move $t0, $sp
+lw $t1, -1260($sp)
+add $t6, $t0, $t1
+lw $t1, -1264($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -1268($sp)
+lw $t1, -152($sp)
+lw $t2, -1268($sp)
+slt $t0, $t1, $t2
+sw $t0, -1272($sp)
+lw $t0, -1272($sp)
+beqz $t0, label30
+lw $t1, -152($sp)
+sw $t1, -156($sp)
+b label31
+label30:
+label31:
+lw $t0, -156($sp)
+# bounds check on a[v31] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1276($sp)
+li $t0, 1
+sw $t0, -1280($sp)
+move $t0, $sp
+lw $t1, -1276($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1280($sp)
+add $t0, $t1, $t2
+sw $t0, -1284($sp)
+move $t0, $sp
+lw $t1, -1276($sp)
+add $t8, $t0, $t1
+lw $t1, -1284($sp)
+sw $t1, ($t8)
+lw $t1, -156($sp)
+sw $t1, -160($sp)
+lw $t0, -160($sp)
+# bounds check on a[v32] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1288($sp)
+move $t0, $sp
+lw $t1, -1288($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1280($sp)
+add $t0, $t1, $t2
+sw $t0, -1292($sp)
+move $t0, $sp
+lw $t1, -1288($sp)
+add $t3, $t0, $t1
+lw $t1, -1292($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -1296($sp)
+lw $t1, -160($sp)
+lw $t2, -1296($sp)
+slt $t0, $t1, $t2
+sw $t0, -1300($sp)
+lw $t0, -1300($sp)
+beqz $t0, label32
+lw $t1, -160($sp)
+sw $t1, -164($sp)
+b label33
+label32:
+label33:
+lw $t0, -164($sp)
+# bounds check on a[v33] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1304($sp)
+li $t0, 1
+sw $t0, -1308($sp)
+move $t0, $sp
+lw $t1, -1304($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1308($sp)
+add $t0, $t1, $t2
+sw $t0, -1312($sp)
+move $t0, $sp
+lw $t1, -1304($sp)
+add $t5, $t0, $t1
+lw $t1, -1312($sp)
+sw $t1, ($t5)
+lw $t1, -164($sp)
+sw $t1, -168($sp)
+lw $t0, -168($sp)
+# bounds check on a[v34] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1316($sp)
+move $t0, $sp
+lw $t1, -1316($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1308($sp)
+add $t0, $t1, $t2
+sw $t0, -1320($sp)
+move $t0, $sp
+lw $t1, -1316($sp)
+add $t7, $t0, $t1
+lw $t1, -1320($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -1324($sp)
+lw $t1, -168($sp)
+lw $t2, -1324($sp)
+slt $t0, $t1, $t2
+sw $t0, -1328($sp)
+lw $t0, -1328($sp)
+beqz $t0, label34
+lw $t1, -168($sp)
+sw $t1, -172($sp)
+b label35
+label34:
+label35:
+lw $t0, -172($sp)
+# bounds check on a[v35] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1332($sp)
+li $t0, 1
+sw $t0, -1336($sp)
+move $t0, $sp
+lw $t1, -1332($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1336($sp)
+add $t0, $t1, $t2
+sw $t0, -1340($sp)
+move $t0, $sp
+lw $t1, -1332($sp)
+add $t9, $t0, $t1
+lw $t1, -1340($sp)
+sw $t1, ($t9)
+lw $t1, -172($sp)
+sw $t1, -176($sp)
+lw $t0, -176($sp)
+# bounds check on a[v36] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1344($sp)
+move $t0, $sp
+lw $t1, -1344($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1336($sp)
+add $t0, $t1, $t2
+sw $t0, -1348($sp)
+move $t0, $sp
+lw $t1, -1344($sp)
+add $t4, $t0, $t1
+lw $t1, -1348($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -1352($sp)
+lw $t1, -176($sp)
+lw $t2, -1352($sp)
+slt $t0, $t1, $t2
+sw $t0, -1356($sp)
+lw $t0, -1356($sp)
+beqz $t0, label36
+lw $t1, -176($sp)
+sw $t1, -180($sp)
+b label37
+label36:
+label37:
+lw $t0, -180($sp)
+# bounds check on a[v37] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1360($sp)
+li $t0, 1
+sw $t0, -1364($sp)
+move $t0, $sp
+lw $t1, -1360($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1364($sp)
+add $t0, $t1, $t2
+sw $t0, -1368($sp)
+move $t0, $sp
+lw $t1, -1360($sp)
+add $t6, $t0, $t1
+lw $t1, -1368($sp)
+sw $t1, ($t6)
+lw $t1, -180($sp)
+sw $t1, -184($sp)
+lw $t0, -184($sp)
+# bounds check on a[v38] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1372($sp)
+move $t0, $sp
+lw $t1, -1372($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1364($sp)
+add $t0, $t1, $t2
+sw $t0, -1376($sp)
+move $t0, $sp
+lw $t1, -1372($sp)
+add $t8, $t0, $t1
+lw $t1, -1376($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -1380($sp)
+lw $t1, -184($sp)
+lw $t2, -1380($sp)
+slt $t0, $t1, $t2
+sw $t0, -1384($sp)
+lw $t0, -1384($sp)
+beqz $t0, label38
+lw $t1, -184($sp)
+sw $t1, -188($sp)
+b label39
+label38:
+label39:
+lw $t0, -188($sp)
+# bounds check on a[v39] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1388($sp)
+li $t0, 1
+sw $t0, -1392($sp)
+move $t0, $sp
+lw $t1, -1388($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1392($sp)
+add $t0, $t1, $t2
+sw $t0, -1396($sp)
+move $t0, $sp
+lw $t1, -1388($sp)
+add $t3, $t0, $t1
+lw $t1, -1396($sp)
+sw $t1, ($t3)
+lw $t1, -188($sp)
+sw $t1, -192($sp)
+lw $t0, -192($sp)
+# bounds check on a[v40] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1400($sp)
+move $t0, $sp
+lw $t1, -1400($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1392($sp)
+add $t0, $t1, $t2
+sw $t0, -1404($sp)
+move $t0, $sp
+lw $t1, -1400($sp)
+add $t5, $t0, $t1
+lw $t1, -1404($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -1408($sp)
+lw $t1, -192($sp)
+lw $t2, -1408($sp)
+slt $t0, $t1, $t2
+sw $t0, -1412($sp)
+lw $t0, -1412($sp)
+beqz $t0, label40
+lw $t1, -192($sp)
+sw $t1, -196($sp)
+b label41
+label40:
+label41:
+lw $t0, -196($sp)
+# bounds check on a[v41] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1416($sp)
+li $t0, 1
+sw $t0, -1420($sp)
+move $t0, $sp
+lw $t1, -1416($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1420($sp)
+add $t0, $t1, $t2
+sw $t0, -1424($sp)
+move $t0, $sp
+lw $t1, -1416($sp)
+add $t7, $t0, $t1
+lw $t1, -1424($sp)
+sw $t1, ($t7)
+lw $t1, -196($sp)
+sw $t1, -200($sp)
+lw $t0, -200($sp)
+# bounds check on a[v42] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1428($sp)
+move $t0, $sp
+lw $t1, -1428($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1420($sp)
+add $t0, $t1, $t2
+sw $t0, -1432($sp)
+move $t0, $sp
+lw $t1, -1428($sp)
+add $t9, $t0, $t1
+lw $t1, -1432($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -1436($sp)
+lw $t1, -200($sp)
+lw $t2, -1436($sp)
+slt $t0, $t1, $t2
+sw $t0, -1440($sp)
+lw $t0, -1440($sp)
+beqz $t0, label42
+lw $t1, -200($sp)
+sw $t1, -204($sp)
+b label43
+label42:
+label43:
+lw $t0, -204($sp)
+# bounds check on a[v43] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1444($sp)
+li $t0, 1
+sw $t0, -1448($sp)
+move $t0, $sp
+lw $t1, -1444($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1448($sp)
+add $t0, $t1, $t2
+sw $t0, -1452($sp)
+move $t0, $sp
+lw $t1, -1444($sp)
+add $t4, $t0, $t1
+lw $t1, -1452($sp)
+sw $t1, ($t4)
+lw $t1, -204($sp)
+sw $t1, -208($sp)
+lw $t0, -208($sp)
+# bounds check on a[v44] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1456($sp)
+move $t0, $sp
+lw $t1, -1456($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1448($sp)
+add $t0, $t1, $t2
+sw $t0, -1460($sp)
+move $t0, $sp
+lw $t1, -1456($sp)
+add $t6, $t0, $t1
+lw $t1, -1460($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -1464($sp)
+lw $t1, -208($sp)
+lw $t2, -1464($sp)
+slt $t0, $t1, $t2
+sw $t0, -1468($sp)
+lw $t0, -1468($sp)
+beqz $t0, label44
+lw $t1, -208($sp)
+sw $t1, -212($sp)
+b label45
+label44:
+label45:
+lw $t0, -212($sp)
+# bounds check on a[v45] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1472($sp)
+li $t0, 1
+sw $t0, -1476($sp)
+move $t0, $sp
+lw $t1, -1472($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1476($sp)
+add $t0, $t1, $t2
+sw $t0, -1480($sp)
+move $t0, $sp
+lw $t1, -1472($sp)
+add $t8, $t0, $t1
+lw $t1, -1480($sp)
+sw $t1, ($t8)
+lw $t1, -212($sp)
+sw $t1, -216($sp)
+lw $t0, -216($sp)
+# bounds check on a[v46] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1484($sp)
+move $t0, $sp
+lw $t1, -1484($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1476($sp)
+add $t0, $t1, $t2
+sw $t0, -1488($sp)
+move $t0, $sp
+lw $t1, -1484($sp)
+add $t3, $t0, $t1
+lw $t1, -1488($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -1492($sp)
+lw $t1, -216($sp)
+lw $t2, -1492($sp)
+slt $t0, $t1, $t2
+sw $t0, -1496($sp)
+lw $t0, -1496($sp)
+beqz $t0, label46
+lw $t1, -216($sp)
+sw $t1, -220($sp)
+b label47
+label46:
+label47:
+lw $t0, -220($sp)
+# bounds check on a[v47] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1500($sp)
+li $t0, 1
+sw $t0, -1504($sp)
+move $t0, $sp
+lw $t1, -1500($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1504($sp)
+add $t0, $t1, $t2
+sw $t0, -1508($sp)
+move $t0, $sp
+lw $t1, -1500($sp)
+add $t5, $t0, $t1
+lw $t1, -1508($sp)
+sw $t1, ($t5)
+lw $t1, -220($sp)
+sw $t1, -224($sp)
+lw $t0, -224($sp)
+# bounds check on a[v48] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1512($sp)
+move $t0, $sp
+lw $t1, -1512($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1504($sp)
+add $t0, $t1, $t2
+sw $t0, -1516($sp)
+move $t0, $sp
+lw $t1, -1512($sp)
+add $t7, $t0, $t1
+lw $t1, -1516($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -1520($sp)
+lw $t1, -224($sp)
+lw $t2, -1520($sp)
+slt $t0, $t1, $t2
+sw $t0, -1524($sp)
+lw $t0, -1524($sp)
+beqz $t0, label48
+lw $t1, -224($sp)
+sw $t1, -228($sp)
+b label49
+label48:
+label49:
+lw $t0, -228($sp)
+# bounds check on a[v49] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1528($sp)
+li $t0, 1
+sw $t0, -1532($sp)
+move $t0, $sp
+lw $t1, -1528($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1532($sp)
+add $t0, $t1, $t2
+sw $t0, -1536($sp)
+move $t0, $sp
+lw $t1, -1528($sp)
+add $t9, $t0, $t1
+lw $t1, -1536($sp)
+sw $t1, ($t9)
+lw $t1, -228($sp)
+sw $t1, -232($sp)
+lw $t0, -232($sp)
+# bounds check on a[v50] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1540($sp)
+move $t0, $sp
+lw $t1, -1540($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1532($sp)
+add $t0, $t1, $t2
+sw $t0, -1544($sp)
+move $t0, $sp
+lw $t1, -1540($sp)
+add $t4, $t0, $t1
+lw $t1, -1544($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -1548($sp)
+lw $t1, -232($sp)
+lw $t2, -1548($sp)
+slt $t0, $t1, $t2
+sw $t0, -1552($sp)
+lw $t0, -1552($sp)
+beqz $t0, label50
+lw $t1, -232($sp)
+sw $t1, -236($sp)
+b label51
+label50:
+label51:
+lw $t0, -236($sp)
+# bounds check on a[v51] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1556($sp)
+li $t0, 1
+sw $t0, -1560($sp)
+move $t0, $sp
+lw $t1, -1556($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1560($sp)
+add $t0, $t1, $t2
+sw $t0, -1564($sp)
+move $t0, $sp
+lw $t1, -1556($sp)
+add $t6, $t0, $t1
+lw $t1, -1564($sp)
+sw $t1, ($t6)
+lw $t1, -236($sp)
+sw $t1, -240($sp)
+lw $t0, -240($sp)
+# bounds check on a[v52] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1568($sp)
+move $t0, $sp
+lw $t1, -1568($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1560($sp)
+add $t0, $t1, $t2
+sw $t0, -1572($sp)
+move $t0, $sp
+lw $t1, -1568($sp)
+add $t8, $t0, $t1
+lw $t1, -1572($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -1576($sp)
+lw $t1, -240($sp)
+lw $t2, -1576($sp)
+slt $t0, $t1, $t2
+sw $t0, -1580($sp)
+lw $t0, -1580($sp)
+beqz $t0, label52
+lw $t1, -240($sp)
+sw $t1, -244($sp)
+b label53
+label52:
+label53:
+lw $t0, -244($sp)
+# bounds check on a[v53] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1584($sp)
+li $t0, 1
+sw $t0, -1588($sp)
+move $t0, $sp
+lw $t1, -1584($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1588($sp)
+add $t0, $t1, $t2
+sw $t0, -1592($sp)
+move $t0, $sp
+lw $t1, -1584($sp)
+add $t3, $t0, $t1
+lw $t1, -1592($sp)
+sw $t1, ($t3)
+lw $t1, -244($sp)
+sw $t1, -248($sp)
+lw $t0, -248($sp)
+# bounds check on a[v54] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1596($sp)
+move $t0, $sp
+lw $t1, -1596($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1588($sp)
+add $t0, $t1, $t2
+sw $t0, -1600($sp)
+move $t0, $sp
+lw $t1, -1596($sp)
+add $t5, $t0, $t1
+lw $t1, -1600($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -1604($sp)
+lw $t1, -248($sp)
+lw $t2, -1604($sp)
+slt $t0, $t1, $t2
+sw $t0, -1608($sp)
+lw $t0, -1608($sp)
+beqz $t0, label54
+lw $t1, -248($sp)
+sw $t1, -252($sp)
+b label55
+label54:
+label55:
+lw $t0, -252($sp)
+# bounds check on a[v55] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1612($sp)
+li $t0, 1
+sw $t0, -1616($sp)
+move $t0, $sp
+lw $t1, -1612($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1616($sp)
+add $t0, $t1, $t2
+sw $t0, -1620($sp)
+move $t0, $sp
+lw $t1, -1612($sp)
+add $t7, $t0, $t1
+lw $t1, -1620($sp)
+sw $t1, ($t7)
+lw $t1, -252($sp)
+sw $t1, -256($sp)
+lw $t0, -256($sp)
+# bounds check on a[v56] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1624($sp)
+move $t0, $sp
+lw $t1, -1624($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1616($sp)
+add $t0, $t1, $t2
+sw $t0, -1628($sp)
+move $t0, $sp
+lw $t1, -1624($sp)
+add $t9, $t0, $t1
+lw $t1, -1628($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -1632($sp)
+lw $t1, -256($sp)
+lw $t2, -1632($sp)
+slt $t0, $t1, $t2
+sw $t0, -1636($sp)
+lw $t0, -1636($sp)
+beqz $t0, label56
+lw $t1, -256($sp)
+sw $t1, -260($sp)
+b label57
+label56:
+label57:
+lw $t0, -260($sp)
+# bounds check on a[v57] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1640($sp)
+li $t0, 1
+sw $t0, -1644($sp)
+move $t0, $sp
+lw $t1, -1640($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1644($sp)
+add $t0, $t1, $t2
+sw $t0, -1648($sp)
+move $t0, $sp
+lw $t1, -1640($sp)
+add $t4, $t0, $t1
+lw $t1, -1648($sp)
+sw $t1, ($t4)
+lw $t1, -260($sp)
+sw $t1, -264($sp)
+lw $t0, -264($sp)
+# bounds check on a[v58] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1652($sp)
+move $t0, $sp
+lw $t1, -1652($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1644($sp)
+add $t0, $t1, $t2
+sw $t0, -1656($sp)
+move $t0, $sp
+lw $t1, -1652($sp)
+add $t6, $t0, $t1
+lw $t1, -1656($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -1660($sp)
+lw $t1, -264($sp)
+lw $t2, -1660($sp)
+slt $t0, $t1, $t2
+sw $t0, -1664($sp)
+lw $t0, -1664($sp)
+beqz $t0, label58
+lw $t1, -264($sp)
+sw $t1, -268($sp)
+b label59
+label58:
+label59:
+lw $t0, -268($sp)
+# bounds check on a[v59] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1668($sp)
+li $t0, 1
+sw $t0, -1672($sp)
+move $t0, $sp
+lw $t1, -1668($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1672($sp)
+add $t0, $t1, $t2
+sw $t0, -1676($sp)
+move $t0, $sp
+lw $t1, -1668($sp)
+add $t8, $t0, $t1
+lw $t1, -1676($sp)
+sw $t1, ($t8)
+lw $t1, -268($sp)
+sw $t1, -272($sp)
+lw $t0, -272($sp)
+# bounds check on a[v60] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1680($sp)
+move $t0, $sp
+lw $t1, -1680($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1672($sp)
+add $t0, $t1, $t2
+sw $t0, -1684($sp)
+move $t0, $sp
+lw $t1, -1680($sp)
+add $t3, $t0, $t1
+lw $t1, -1684($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -1688($sp)
+lw $t1, -272($sp)
+lw $t2, -1688($sp)
+slt $t0, $t1, $t2
+sw $t0, -1692($sp)
+lw $t0, -1692($sp)
+beqz $t0, label60
+lw $t1, -272($sp)
+sw $t1, -276($sp)
+b label61
+label60:
+label61:
+lw $t0, -276($sp)
+# bounds check on a[v61] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1696($sp)
+li $t0, 1
+sw $t0, -1700($sp)
+move $t0, $sp
+lw $t1, -1696($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1700($sp)
+add $t0, $t1, $t2
+sw $t0, -1704($sp)
+move $t0, $sp
+lw $t1, -1696($sp)
+add $t5, $t0, $t1
+lw $t1, -1704($sp)
+sw $t1, ($t5)
+lw $t1, -276($sp)
+sw $t1, -280($sp)
+lw $t0, -280($sp)
+# bounds check on a[v62] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1708($sp)
+move $t0, $sp
+lw $t1, -1708($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1700($sp)
+add $t0, $t1, $t2
+sw $t0, -1712($sp)
+move $t0, $sp
+lw $t1, -1708($sp)
+add $t7, $t0, $t1
+lw $t1, -1712($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -1716($sp)
+lw $t1, -280($sp)
+lw $t2, -1716($sp)
+slt $t0, $t1, $t2
+sw $t0, -1720($sp)
+lw $t0, -1720($sp)
+beqz $t0, label62
+lw $t1, -280($sp)
+sw $t1, -284($sp)
+b label63
+label62:
+label63:
+lw $t0, -284($sp)
+# bounds check on a[v63] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1724($sp)
+li $t0, 1
+sw $t0, -1728($sp)
+move $t0, $sp
+lw $t1, -1724($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1728($sp)
+add $t0, $t1, $t2
+sw $t0, -1732($sp)
+move $t0, $sp
+lw $t1, -1724($sp)
+add $t9, $t0, $t1
+lw $t1, -1732($sp)
+sw $t1, ($t9)
+lw $t1, -284($sp)
+sw $t1, -288($sp)
+lw $t0, -288($sp)
+# bounds check on a[v64] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1736($sp)
+move $t0, $sp
+lw $t1, -1736($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1728($sp)
+add $t0, $t1, $t2
+sw $t0, -1740($sp)
+move $t0, $sp
+lw $t1, -1736($sp)
+add $t4, $t0, $t1
+lw $t1, -1740($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -1744($sp)
+lw $t1, -288($sp)
+lw $t2, -1744($sp)
+slt $t0, $t1, $t2
+sw $t0, -1748($sp)
+lw $t0, -1748($sp)
+beqz $t0, label64
+lw $t1, -288($sp)
+sw $t1, -292($sp)
+b label65
+label64:
+label65:
+lw $t0, -292($sp)
+# bounds check on a[v65] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1752($sp)
+li $t0, 1
+sw $t0, -1756($sp)
+move $t0, $sp
+lw $t1, -1752($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1756($sp)
+add $t0, $t1, $t2
+sw $t0, -1760($sp)
+move $t0, $sp
+lw $t1, -1752($sp)
+add $t6, $t0, $t1
+lw $t1, -1760($sp)
+sw $t1, ($t6)
+lw $t1, -292($sp)
+sw $t1, -296($sp)
+lw $t0, -296($sp)
+# bounds check on a[v66] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1764($sp)
+move $t0, $sp
+lw $t1, -1764($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1756($sp)
+add $t0, $t1, $t2
+sw $t0, -1768($sp)
+move $t0, $sp
+lw $t1, -1764($sp)
+add $t8, $t0, $t1
+lw $t1, -1768($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -1772($sp)
+lw $t1, -296($sp)
+lw $t2, -1772($sp)
+slt $t0, $t1, $t2
+sw $t0, -1776($sp)
+lw $t0, -1776($sp)
+beqz $t0, label66
+lw $t1, -296($sp)
+sw $t1, -300($sp)
+b label67
+label66:
+label67:
+lw $t0, -300($sp)
+# bounds check on a[v67] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1780($sp)
+li $t0, 1
+sw $t0, -1784($sp)
+move $t0, $sp
+lw $t1, -1780($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1784($sp)
+add $t0, $t1, $t2
+sw $t0, -1788($sp)
+move $t0, $sp
+lw $t1, -1780($sp)
+add $t3, $t0, $t1
+lw $t1, -1788($sp)
+sw $t1, ($t3)
+lw $t1, -300($sp)
+sw $t1, -304($sp)
+lw $t0, -304($sp)
+# bounds check on a[v68] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1792($sp)
+move $t0, $sp
+lw $t1, -1792($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1784($sp)
+add $t0, $t1, $t2
+sw $t0, -1796($sp)
+move $t0, $sp
+lw $t1, -1792($sp)
+add $t5, $t0, $t1
+lw $t1, -1796($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -1800($sp)
+lw $t1, -304($sp)
+lw $t2, -1800($sp)
+slt $t0, $t1, $t2
+sw $t0, -1804($sp)
+lw $t0, -1804($sp)
+beqz $t0, label68
+lw $t1, -304($sp)
+sw $t1, -308($sp)
+b label69
+label68:
+label69:
+lw $t0, -308($sp)
+# bounds check on a[v69] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1808($sp)
+li $t0, 1
+sw $t0, -1812($sp)
+move $t0, $sp
+lw $t1, -1808($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1812($sp)
+add $t0, $t1, $t2
+sw $t0, -1816($sp)
+move $t0, $sp
+lw $t1, -1808($sp)
+add $t7, $t0, $t1
+lw $t1, -1816($sp)
+sw $t1, ($t7)
+lw $t1, -308($sp)
+sw $t1, -312($sp)
+lw $t0, -312($sp)
+# bounds check on a[v70] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1820($sp)
+move $t0, $sp
+lw $t1, -1820($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1812($sp)
+add $t0, $t1, $t2
+sw $t0, -1824($sp)
+move $t0, $sp
+lw $t1, -1820($sp)
+add $t9, $t0, $t1
+lw $t1, -1824($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -1828($sp)
+lw $t1, -312($sp)
+lw $t2, -1828($sp)
+slt $t0, $t1, $t2
+sw $t0, -1832($sp)
+lw $t0, -1832($sp)
+beqz $t0, label70
+lw $t1, -312($sp)
+sw $t1, -316($sp)
+b label71
+label70:
+label71:
+lw $t0, -316($sp)
+# bounds check on a[v71] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1836($sp)
+li $t0, 1
+sw $t0, -1840($sp)
+move $t0, $sp
+lw $t1, -1836($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1840($sp)
+add $t0, $t1, $t2
+sw $t0, -1844($sp)
+move $t0, $sp
+lw $t1, -1836($sp)
+add $t4, $t0, $t1
+lw $t1, -1844($sp)
+sw $t1, ($t4)
+lw $t1, -316($sp)
+sw $t1, -320($sp)
+lw $t0, -320($sp)
+# bounds check on a[v72] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1848($sp)
+move $t0, $sp
+lw $t1, -1848($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1840($sp)
+add $t0, $t1, $t2
+sw $t0, -1852($sp)
+move $t0, $sp
+lw $t1, -1848($sp)
+add $t6, $t0, $t1
+lw $t1, -1852($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -1856($sp)
+lw $t1, -320($sp)
+lw $t2, -1856($sp)
+slt $t0, $t1, $t2
+sw $t0, -1860($sp)
+lw $t0, -1860($sp)
+beqz $t0, label72
+lw $t1, -320($sp)
+sw $t1, -324($sp)
+b label73
+label72:
+label73:
+lw $t0, -324($sp)
+# bounds check on a[v73] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1864($sp)
+li $t0, 1
+sw $t0, -1868($sp)
+move $t0, $sp
+lw $t1, -1864($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1868($sp)
+add $t0, $t1, $t2
+sw $t0, -1872($sp)
+move $t0, $sp
+lw $t1, -1864($sp)
+add $t8, $t0, $t1
+lw $t1, -1872($sp)
+sw $t1, ($t8)
+lw $t1, -324($sp)
+sw $t1, -328($sp)
+lw $t0, -328($sp)
+# bounds check on a[v74] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1876($sp)
+move $t0, $sp
+lw $t1, -1876($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1868($sp)
+add $t0, $t1, $t2
+sw $t0, -1880($sp)
+move $t0, $sp
+lw $t1, -1876($sp)
+add $t3, $t0, $t1
+lw $t1, -1880($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -1884($sp)
+lw $t1, -328($sp)
+lw $t2, -1884($sp)
+slt $t0, $t1, $t2
+sw $t0, -1888($sp)
+lw $t0, -1888($sp)
+beqz $t0, label74
+lw $t1, -328($sp)
+sw $t1, -332($sp)
+b label75
+label74:
+label75:
+lw $t0, -332($sp)
+# bounds check on a[v75] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1892($sp)
+li $t0, 1
+sw $t0, -1896($sp)
+move $t0, $sp
+lw $t1, -1892($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1896($sp)
+add $t0, $t1, $t2
+sw $t0, -1900($sp)
+move $t0, $sp
+lw $t1, -1892($sp)
+add $t5, $t0, $t1
+lw $t1, -1900($sp)
+sw $t1, ($t5)
+lw $t1, -332($sp)
+sw $t1, -336($sp)
+lw $t0, -336($sp)
+# bounds check on a[v76] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1904($sp)
+move $t0, $sp
+lw $t1, -1904($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -1896($sp)
+add $t0, $t1, $t2
+sw $t0, -1908($sp)
+move $t0, $sp
+lw $t1, -1904($sp)
+add $t7, $t0, $t1
+lw $t1, -1908($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -1912($sp)
+lw $t1, -336($sp)
+lw $t2, -1912($sp)
+slt $t0, $t1, $t2
+sw $t0, -1916($sp)
+lw $t0, -1916($sp)
+beqz $t0, label76
+lw $t1, -336($sp)
+sw $t1, -340($sp)
+b label77
+label76:
+label77:
+lw $t0, -340($sp)
+# bounds check on a[v77] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1920($sp)
+li $t0, 1
+sw $t0, -1924($sp)
+move $t0, $sp
+lw $t1, -1920($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -1924($sp)
+add $t0, $t1, $t2
+sw $t0, -1928($sp)
+move $t0, $sp
+lw $t1, -1920($sp)
+add $t9, $t0, $t1
+lw $t1, -1928($sp)
+sw $t1, ($t9)
+lw $t1, -340($sp)
+sw $t1, -344($sp)
+lw $t0, -344($sp)
+# bounds check on a[v78] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1932($sp)
+move $t0, $sp
+lw $t1, -1932($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -1924($sp)
+add $t0, $t1, $t2
+sw $t0, -1936($sp)
+move $t0, $sp
+lw $t1, -1932($sp)
+add $t4, $t0, $t1
+lw $t1, -1936($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -1940($sp)
+lw $t1, -344($sp)
+lw $t2, -1940($sp)
+slt $t0, $t1, $t2
+sw $t0, -1944($sp)
+lw $t0, -1944($sp)
+beqz $t0, label78
+lw $t1, -344($sp)
+sw $t1, -348($sp)
+b label79
+label78:
+label79:
+lw $t0, -348($sp)
+# bounds check on a[v79] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1948($sp)
+li $t0, 1
+sw $t0, -1952($sp)
+move $t0, $sp
+lw $t1, -1948($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -1952($sp)
+add $t0, $t1, $t2
+sw $t0, -1956($sp)
+move $t0, $sp
+lw $t1, -1948($sp)
+add $t6, $t0, $t1
+lw $t1, -1956($sp)
+sw $t1, ($t6)
+lw $t1, -348($sp)
+sw $t1, -352($sp)
+lw $t0, -352($sp)
+# bounds check on a[v80] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1960($sp)
+move $t0, $sp
+lw $t1, -1960($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -1952($sp)
+add $t0, $t1, $t2
+sw $t0, -1964($sp)
+move $t0, $sp
+lw $t1, -1960($sp)
+add $t8, $t0, $t1
+lw $t1, -1964($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -1968($sp)
+lw $t1, -352($sp)
+lw $t2, -1968($sp)
+slt $t0, $t1, $t2
+sw $t0, -1972($sp)
+lw $t0, -1972($sp)
+beqz $t0, label80
+lw $t1, -352($sp)
+sw $t1, -356($sp)
+b label81
+label80:
+label81:
+lw $t0, -356($sp)
+# bounds check on a[v81] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1976($sp)
+li $t0, 1
+sw $t0, -1980($sp)
+move $t0, $sp
+lw $t1, -1976($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -1980($sp)
+add $t0, $t1, $t2
+sw $t0, -1984($sp)
+move $t0, $sp
+lw $t1, -1976($sp)
+add $t3, $t0, $t1
+lw $t1, -1984($sp)
+sw $t1, ($t3)
+lw $t1, -356($sp)
+sw $t1, -360($sp)
+lw $t0, -360($sp)
+# bounds check on a[v82] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -1988($sp)
+move $t0, $sp
+lw $t1, -1988($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -1980($sp)
+add $t0, $t1, $t2
+sw $t0, -1992($sp)
+move $t0, $sp
+lw $t1, -1988($sp)
+add $t5, $t0, $t1
+lw $t1, -1992($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -1996($sp)
+lw $t1, -360($sp)
+lw $t2, -1996($sp)
+slt $t0, $t1, $t2
+sw $t0, -2000($sp)
+lw $t0, -2000($sp)
+beqz $t0, label82
+lw $t1, -360($sp)
+sw $t1, -364($sp)
+b label83
+label82:
+label83:
+lw $t0, -364($sp)
+# bounds check on a[v83] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2004($sp)
+li $t0, 1
+sw $t0, -2008($sp)
+move $t0, $sp
+lw $t1, -2004($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2008($sp)
+add $t0, $t1, $t2
+sw $t0, -2012($sp)
+move $t0, $sp
+lw $t1, -2004($sp)
+add $t7, $t0, $t1
+lw $t1, -2012($sp)
+sw $t1, ($t7)
+lw $t1, -364($sp)
+sw $t1, -368($sp)
+lw $t0, -368($sp)
+# bounds check on a[v84] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2016($sp)
+move $t0, $sp
+lw $t1, -2016($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2008($sp)
+add $t0, $t1, $t2
+sw $t0, -2020($sp)
+move $t0, $sp
+lw $t1, -2016($sp)
+add $t9, $t0, $t1
+lw $t1, -2020($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -2024($sp)
+lw $t1, -368($sp)
+lw $t2, -2024($sp)
+slt $t0, $t1, $t2
+sw $t0, -2028($sp)
+lw $t0, -2028($sp)
+beqz $t0, label84
+lw $t1, -368($sp)
+sw $t1, -372($sp)
+b label85
+label84:
+label85:
+lw $t0, -372($sp)
+# bounds check on a[v85] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2032($sp)
+li $t0, 1
+sw $t0, -2036($sp)
+move $t0, $sp
+lw $t1, -2032($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2036($sp)
+add $t0, $t1, $t2
+sw $t0, -2040($sp)
+move $t0, $sp
+lw $t1, -2032($sp)
+add $t4, $t0, $t1
+lw $t1, -2040($sp)
+sw $t1, ($t4)
+lw $t1, -372($sp)
+sw $t1, -376($sp)
+lw $t0, -376($sp)
+# bounds check on a[v86] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2044($sp)
+move $t0, $sp
+lw $t1, -2044($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2036($sp)
+add $t0, $t1, $t2
+sw $t0, -2048($sp)
+move $t0, $sp
+lw $t1, -2044($sp)
+add $t6, $t0, $t1
+lw $t1, -2048($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -2052($sp)
+lw $t1, -376($sp)
+lw $t2, -2052($sp)
+slt $t0, $t1, $t2
+sw $t0, -2056($sp)
+lw $t0, -2056($sp)
+beqz $t0, label86
+lw $t1, -376($sp)
+sw $t1, -380($sp)
+b label87
+label86:
+label87:
+lw $t0, -380($sp)
+# bounds check on a[v87] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2060($sp)
+li $t0, 1
+sw $t0, -2064($sp)
+move $t0, $sp
+lw $t1, -2060($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2064($sp)
+add $t0, $t1, $t2
+sw $t0, -2068($sp)
+move $t0, $sp
+lw $t1, -2060($sp)
+add $t8, $t0, $t1
+lw $t1, -2068($sp)
+sw $t1, ($t8)
+lw $t1, -380($sp)
+sw $t1, -384($sp)
+lw $t0, -384($sp)
+# bounds check on a[v88] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2072($sp)
+move $t0, $sp
+lw $t1, -2072($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2064($sp)
+add $t0, $t1, $t2
+sw $t0, -2076($sp)
+move $t0, $sp
+lw $t1, -2072($sp)
+add $t3, $t0, $t1
+lw $t1, -2076($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -2080($sp)
+lw $t1, -384($sp)
+lw $t2, -2080($sp)
+slt $t0, $t1, $t2
+sw $t0, -2084($sp)
+lw $t0, -2084($sp)
+beqz $t0, label88
+lw $t1, -384($sp)
+sw $t1, -388($sp)
+b label89
+label88:
+label89:
+lw $t0, -388($sp)
+# bounds check on a[v89] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2088($sp)
+li $t0, 1
+sw $t0, -2092($sp)
+move $t0, $sp
+lw $t1, -2088($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2092($sp)
+add $t0, $t1, $t2
+sw $t0, -2096($sp)
+move $t0, $sp
+lw $t1, -2088($sp)
+add $t5, $t0, $t1
+lw $t1, -2096($sp)
+sw $t1, ($t5)
+lw $t1, -388($sp)
+sw $t1, -392($sp)
+lw $t0, -392($sp)
+# bounds check on a[v90] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2100($sp)
+move $t0, $sp
+lw $t1, -2100($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2092($sp)
+add $t0, $t1, $t2
+sw $t0, -2104($sp)
+move $t0, $sp
+lw $t1, -2100($sp)
+add $t7, $t0, $t1
+lw $t1, -2104($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -2108($sp)
+lw $t1, -392($sp)
+lw $t2, -2108($sp)
+slt $t0, $t1, $t2
+sw $t0, -2112($sp)
+lw $t0, -2112($sp)
+beqz $t0, label90
+lw $t1, -392($sp)
+sw $t1, -396($sp)
+b label91
+label90:
+label91:
+lw $t0, -396($sp)
+# bounds check on a[v91] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2116($sp)
+li $t0, 1
+sw $t0, -2120($sp)
+move $t0, $sp
+lw $t1, -2116($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2120($sp)
+add $t0, $t1, $t2
+sw $t0, -2124($sp)
+move $t0, $sp
+lw $t1, -2116($sp)
+add $t9, $t0, $t1
+lw $t1, -2124($sp)
+sw $t1, ($t9)
+lw $t1, -396($sp)
+sw $t1, -400($sp)
+lw $t0, -400($sp)
+# bounds check on a[v92] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2128($sp)
+move $t0, $sp
+lw $t1, -2128($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2120($sp)
+add $t0, $t1, $t2
+sw $t0, -2132($sp)
+move $t0, $sp
+lw $t1, -2128($sp)
+add $t4, $t0, $t1
+lw $t1, -2132($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -2136($sp)
+lw $t1, -400($sp)
+lw $t2, -2136($sp)
+slt $t0, $t1, $t2
+sw $t0, -2140($sp)
+lw $t0, -2140($sp)
+beqz $t0, label92
+lw $t1, -400($sp)
+sw $t1, -404($sp)
+b label93
+label92:
+label93:
+lw $t0, -404($sp)
+# bounds check on a[v93] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2144($sp)
+li $t0, 1
+sw $t0, -2148($sp)
+move $t0, $sp
+lw $t1, -2144($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2148($sp)
+add $t0, $t1, $t2
+sw $t0, -2152($sp)
+move $t0, $sp
+lw $t1, -2144($sp)
+add $t6, $t0, $t1
+lw $t1, -2152($sp)
+sw $t1, ($t6)
+lw $t1, -404($sp)
+sw $t1, -408($sp)
+lw $t0, -408($sp)
+# bounds check on a[v94] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2156($sp)
+move $t0, $sp
+lw $t1, -2156($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2148($sp)
+add $t0, $t1, $t2
+sw $t0, -2160($sp)
+move $t0, $sp
+lw $t1, -2156($sp)
+add $t8, $t0, $t1
+lw $t1, -2160($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -2164($sp)
+lw $t1, -408($sp)
+lw $t2, -2164($sp)
+slt $t0, $t1, $t2
+sw $t0, -2168($sp)
+lw $t0, -2168($sp)
+beqz $t0, label94
+lw $t1, -408($sp)
+sw $t1, -412($sp)
+b label95
+label94:
+label95:
+lw $t0, -412($sp)
+# bounds check on a[v95] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2172($sp)
+li $t0, 1
+sw $t0, -2176($sp)
+move $t0, $sp
+lw $t1, -2172($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2176($sp)
+add $t0, $t1, $t2
+sw $t0, -2180($sp)
+move $t0, $sp
+lw $t1, -2172($sp)
+add $t3, $t0, $t1
+lw $t1, -2180($sp)
+sw $t1, ($t3)
+lw $t1, -412($sp)
+sw $t1, -416($sp)
+lw $t0, -416($sp)
+# bounds check on a[v96] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2184($sp)
+move $t0, $sp
+lw $t1, -2184($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2176($sp)
+add $t0, $t1, $t2
+sw $t0, -2188($sp)
+move $t0, $sp
+lw $t1, -2184($sp)
+add $t5, $t0, $t1
+lw $t1, -2188($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -2192($sp)
+lw $t1, -416($sp)
+lw $t2, -2192($sp)
+slt $t0, $t1, $t2
+sw $t0, -2196($sp)
+lw $t0, -2196($sp)
+beqz $t0, label96
+lw $t1, -416($sp)
+sw $t1, -420($sp)
+b label97
+label96:
+label97:
+lw $t0, -420($sp)
+# bounds check on a[v97] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2200($sp)
+li $t0, 1
+sw $t0, -2204($sp)
+move $t0, $sp
+lw $t1, -2200($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2204($sp)
+add $t0, $t1, $t2
+sw $t0, -2208($sp)
+move $t0, $sp
+lw $t1, -2200($sp)
+add $t7, $t0, $t1
+lw $t1, -2208($sp)
+sw $t1, ($t7)
+lw $t1, -420($sp)
+sw $t1, -424($sp)
+lw $t0, -424($sp)
+# bounds check on a[v98] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2212($sp)
+move $t0, $sp
+lw $t1, -2212($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2204($sp)
+add $t0, $t1, $t2
+sw $t0, -2216($sp)
+move $t0, $sp
+lw $t1, -2212($sp)
+add $t9, $t0, $t1
+lw $t1, -2216($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -2220($sp)
+lw $t1, -424($sp)
+lw $t2, -2220($sp)
+slt $t0, $t1, $t2
+sw $t0, -2224($sp)
+lw $t0, -2224($sp)
+beqz $t0, label98
+lw $t1, -424($sp)
+sw $t1, -428($sp)
+b label99
+label98:
+label99:
+lw $t0, -428($sp)
+# bounds check on a[v99] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2228($sp)
+li $t0, 1
+sw $t0, -2232($sp)
+move $t0, $sp
+lw $t1, -2228($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2232($sp)
+add $t0, $t1, $t2
+sw $t0, -2236($sp)
+move $t0, $sp
+lw $t1, -2228($sp)
+add $t4, $t0, $t1
+lw $t1, -2236($sp)
+sw $t1, ($t4)
+lw $t1, -428($sp)
+sw $t1, -432($sp)
+lw $t0, -432($sp)
+# bounds check on a[v100] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2240($sp)
+move $t0, $sp
+lw $t1, -2240($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2232($sp)
+add $t0, $t1, $t2
+sw $t0, -2244($sp)
+move $t0, $sp
+lw $t1, -2240($sp)
+add $t6, $t0, $t1
+lw $t1, -2244($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -2248($sp)
+lw $t1, -432($sp)
+lw $t2, -2248($sp)
+slt $t0, $t1, $t2
+sw $t0, -2252($sp)
+lw $t0, -2252($sp)
+beqz $t0, label100
+lw $t1, -432($sp)
+sw $t1, -436($sp)
+b label101
+label100:
+label101:
+lw $t0, -436($sp)
+# bounds check on a[v101] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2256($sp)
+li $t0, 1
+sw $t0, -2260($sp)
+move $t0, $sp
+lw $t1, -2256($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2260($sp)
+add $t0, $t1, $t2
+sw $t0, -2264($sp)
+move $t0, $sp
+lw $t1, -2256($sp)
+add $t8, $t0, $t1
+lw $t1, -2264($sp)
+sw $t1, ($t8)
+lw $t1, -436($sp)
+sw $t1, -440($sp)
+lw $t0, -440($sp)
+# bounds check on a[v102] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2268($sp)
+move $t0, $sp
+lw $t1, -2268($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2260($sp)
+add $t0, $t1, $t2
+sw $t0, -2272($sp)
+move $t0, $sp
+lw $t1, -2268($sp)
+add $t3, $t0, $t1
+lw $t1, -2272($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -2276($sp)
+lw $t1, -440($sp)
+lw $t2, -2276($sp)
+slt $t0, $t1, $t2
+sw $t0, -2280($sp)
+lw $t0, -2280($sp)
+beqz $t0, label102
+lw $t1, -440($sp)
+sw $t1, -444($sp)
+b label103
+label102:
+label103:
+lw $t0, -444($sp)
+# bounds check on a[v103] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2284($sp)
+li $t0, 1
+sw $t0, -2288($sp)
+move $t0, $sp
+lw $t1, -2284($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2288($sp)
+add $t0, $t1, $t2
+sw $t0, -2292($sp)
+move $t0, $sp
+lw $t1, -2284($sp)
+add $t5, $t0, $t1
+lw $t1, -2292($sp)
+sw $t1, ($t5)
+lw $t1, -444($sp)
+sw $t1, -448($sp)
+lw $t0, -448($sp)
+# bounds check on a[v104] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2296($sp)
+move $t0, $sp
+lw $t1, -2296($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2288($sp)
+add $t0, $t1, $t2
+sw $t0, -2300($sp)
+move $t0, $sp
+lw $t1, -2296($sp)
+add $t7, $t0, $t1
+lw $t1, -2300($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -2304($sp)
+lw $t1, -448($sp)
+lw $t2, -2304($sp)
+slt $t0, $t1, $t2
+sw $t0, -2308($sp)
+lw $t0, -2308($sp)
+beqz $t0, label104
+lw $t1, -448($sp)
+sw $t1, -452($sp)
+b label105
+label104:
+label105:
+lw $t0, -452($sp)
+# bounds check on a[v105] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2312($sp)
+li $t0, 1
+sw $t0, -2316($sp)
+move $t0, $sp
+lw $t1, -2312($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2316($sp)
+add $t0, $t1, $t2
+sw $t0, -2320($sp)
+move $t0, $sp
+lw $t1, -2312($sp)
+add $t9, $t0, $t1
+lw $t1, -2320($sp)
+sw $t1, ($t9)
+lw $t1, -452($sp)
+sw $t1, -456($sp)
+lw $t0, -456($sp)
+# bounds check on a[v106] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2324($sp)
+move $t0, $sp
+lw $t1, -2324($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2316($sp)
+add $t0, $t1, $t2
+sw $t0, -2328($sp)
+move $t0, $sp
+lw $t1, -2324($sp)
+add $t4, $t0, $t1
+lw $t1, -2328($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -2332($sp)
+lw $t1, -456($sp)
+lw $t2, -2332($sp)
+slt $t0, $t1, $t2
+sw $t0, -2336($sp)
+lw $t0, -2336($sp)
+beqz $t0, label106
+lw $t1, -456($sp)
+sw $t1, -460($sp)
+b label107
+label106:
+label107:
+lw $t0, -460($sp)
+# bounds check on a[v107] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2340($sp)
+li $t0, 1
+sw $t0, -2344($sp)
+move $t0, $sp
+lw $t1, -2340($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2344($sp)
+add $t0, $t1, $t2
+sw $t0, -2348($sp)
+move $t0, $sp
+lw $t1, -2340($sp)
+add $t6, $t0, $t1
+lw $t1, -2348($sp)
+sw $t1, ($t6)
+lw $t1, -460($sp)
+sw $t1, -464($sp)
+lw $t0, -464($sp)
+# bounds check on a[v108] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2352($sp)
+move $t0, $sp
+lw $t1, -2352($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2344($sp)
+add $t0, $t1, $t2
+sw $t0, -2356($sp)
+move $t0, $sp
+lw $t1, -2352($sp)
+add $t8, $t0, $t1
+lw $t1, -2356($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -2360($sp)
+lw $t1, -464($sp)
+lw $t2, -2360($sp)
+slt $t0, $t1, $t2
+sw $t0, -2364($sp)
+lw $t0, -2364($sp)
+beqz $t0, label108
+lw $t1, -464($sp)
+sw $t1, -468($sp)
+b label109
+label108:
+label109:
+lw $t0, -468($sp)
+# bounds check on a[v109] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2368($sp)
+li $t0, 1
+sw $t0, -2372($sp)
+move $t0, $sp
+lw $t1, -2368($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2372($sp)
+add $t0, $t1, $t2
+sw $t0, -2376($sp)
+move $t0, $sp
+lw $t1, -2368($sp)
+add $t3, $t0, $t1
+lw $t1, -2376($sp)
+sw $t1, ($t3)
+lw $t1, -468($sp)
+sw $t1, -472($sp)
+lw $t0, -472($sp)
+# bounds check on a[v110] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2380($sp)
+move $t0, $sp
+lw $t1, -2380($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2372($sp)
+add $t0, $t1, $t2
+sw $t0, -2384($sp)
+move $t0, $sp
+lw $t1, -2380($sp)
+add $t5, $t0, $t1
+lw $t1, -2384($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -2388($sp)
+lw $t1, -472($sp)
+lw $t2, -2388($sp)
+slt $t0, $t1, $t2
+sw $t0, -2392($sp)
+lw $t0, -2392($sp)
+beqz $t0, label110
+lw $t1, -472($sp)
+sw $t1, -476($sp)
+b label111
+label110:
+label111:
+lw $t0, -476($sp)
+# bounds check on a[v111] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2396($sp)
+li $t0, 1
+sw $t0, -2400($sp)
+move $t0, $sp
+lw $t1, -2396($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2400($sp)
+add $t0, $t1, $t2
+sw $t0, -2404($sp)
+move $t0, $sp
+lw $t1, -2396($sp)
+add $t7, $t0, $t1
+lw $t1, -2404($sp)
+sw $t1, ($t7)
+lw $t1, -476($sp)
+sw $t1, -480($sp)
+lw $t0, -480($sp)
+# bounds check on a[v112] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2408($sp)
+move $t0, $sp
+lw $t1, -2408($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2400($sp)
+add $t0, $t1, $t2
+sw $t0, -2412($sp)
+move $t0, $sp
+lw $t1, -2408($sp)
+add $t9, $t0, $t1
+lw $t1, -2412($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -2416($sp)
+lw $t1, -480($sp)
+lw $t2, -2416($sp)
+slt $t0, $t1, $t2
+sw $t0, -2420($sp)
+lw $t0, -2420($sp)
+beqz $t0, label112
+lw $t1, -480($sp)
+sw $t1, -484($sp)
+b label113
+label112:
+label113:
+lw $t0, -484($sp)
+# bounds check on a[v113] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2424($sp)
+li $t0, 1
+sw $t0, -2428($sp)
+move $t0, $sp
+lw $t1, -2424($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2428($sp)
+add $t0, $t1, $t2
+sw $t0, -2432($sp)
+move $t0, $sp
+lw $t1, -2424($sp)
+add $t4, $t0, $t1
+lw $t1, -2432($sp)
+sw $t1, ($t4)
+lw $t1, -484($sp)
+sw $t1, -488($sp)
+lw $t0, -488($sp)
+# bounds check on a[v114] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2436($sp)
+move $t0, $sp
+lw $t1, -2436($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2428($sp)
+add $t0, $t1, $t2
+sw $t0, -2440($sp)
+move $t0, $sp
+lw $t1, -2436($sp)
+add $t6, $t0, $t1
+lw $t1, -2440($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -2444($sp)
+lw $t1, -488($sp)
+lw $t2, -2444($sp)
+slt $t0, $t1, $t2
+sw $t0, -2448($sp)
+lw $t0, -2448($sp)
+beqz $t0, label114
+lw $t1, -488($sp)
+sw $t1, -492($sp)
+b label115
+label114:
+label115:
+lw $t0, -492($sp)
+# bounds check on a[v115] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2452($sp)
+li $t0, 1
+sw $t0, -2456($sp)
+move $t0, $sp
+lw $t1, -2452($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2456($sp)
+add $t0, $t1, $t2
+sw $t0, -2460($sp)
+move $t0, $sp
+lw $t1, -2452($sp)
+add $t8, $t0, $t1
+lw $t1, -2460($sp)
+sw $t1, ($t8)
+lw $t1, -492($sp)
+sw $t1, -496($sp)
+lw $t0, -496($sp)
+# bounds check on a[v116] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2464($sp)
+move $t0, $sp
+lw $t1, -2464($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2456($sp)
+add $t0, $t1, $t2
+sw $t0, -2468($sp)
+move $t0, $sp
+lw $t1, -2464($sp)
+add $t3, $t0, $t1
+lw $t1, -2468($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -2472($sp)
+lw $t1, -496($sp)
+lw $t2, -2472($sp)
+slt $t0, $t1, $t2
+sw $t0, -2476($sp)
+lw $t0, -2476($sp)
+beqz $t0, label116
+lw $t1, -496($sp)
+sw $t1, -500($sp)
+b label117
+label116:
+label117:
+lw $t0, -500($sp)
+# bounds check on a[v117] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2480($sp)
+li $t0, 1
+sw $t0, -2484($sp)
+move $t0, $sp
+lw $t1, -2480($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2484($sp)
+add $t0, $t1, $t2
+sw $t0, -2488($sp)
+move $t0, $sp
+lw $t1, -2480($sp)
+add $t5, $t0, $t1
+lw $t1, -2488($sp)
+sw $t1, ($t5)
+lw $t1, -500($sp)
+sw $t1, -504($sp)
+lw $t0, -504($sp)
+# bounds check on a[v118] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2492($sp)
+move $t0, $sp
+lw $t1, -2492($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2484($sp)
+add $t0, $t1, $t2
+sw $t0, -2496($sp)
+move $t0, $sp
+lw $t1, -2492($sp)
+add $t7, $t0, $t1
+lw $t1, -2496($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -2500($sp)
+lw $t1, -504($sp)
+lw $t2, -2500($sp)
+slt $t0, $t1, $t2
+sw $t0, -2504($sp)
+lw $t0, -2504($sp)
+beqz $t0, label118
+lw $t1, -504($sp)
+sw $t1, -508($sp)
+b label119
+label118:
+label119:
+lw $t0, -508($sp)
+# bounds check on a[v119] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2508($sp)
+li $t0, 1
+sw $t0, -2512($sp)
+move $t0, $sp
+lw $t1, -2508($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2512($sp)
+add $t0, $t1, $t2
+sw $t0, -2516($sp)
+move $t0, $sp
+lw $t1, -2508($sp)
+add $t9, $t0, $t1
+lw $t1, -2516($sp)
+sw $t1, ($t9)
+lw $t1, -508($sp)
+sw $t1, -512($sp)
+lw $t0, -512($sp)
+# bounds check on a[v120] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2520($sp)
+move $t0, $sp
+lw $t1, -2520($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2512($sp)
+add $t0, $t1, $t2
+sw $t0, -2524($sp)
+move $t0, $sp
+lw $t1, -2520($sp)
+add $t4, $t0, $t1
+lw $t1, -2524($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -2528($sp)
+lw $t1, -512($sp)
+lw $t2, -2528($sp)
+slt $t0, $t1, $t2
+sw $t0, -2532($sp)
+lw $t0, -2532($sp)
+beqz $t0, label120
+lw $t1, -512($sp)
+sw $t1, -516($sp)
+b label121
+label120:
+label121:
+lw $t0, -516($sp)
+# bounds check on a[v121] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2536($sp)
+li $t0, 1
+sw $t0, -2540($sp)
+move $t0, $sp
+lw $t1, -2536($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2540($sp)
+add $t0, $t1, $t2
+sw $t0, -2544($sp)
+move $t0, $sp
+lw $t1, -2536($sp)
+add $t6, $t0, $t1
+lw $t1, -2544($sp)
+sw $t1, ($t6)
+lw $t1, -516($sp)
+sw $t1, -520($sp)
+lw $t0, -520($sp)
+# bounds check on a[v122] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2548($sp)
+move $t0, $sp
+lw $t1, -2548($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2540($sp)
+add $t0, $t1, $t2
+sw $t0, -2552($sp)
+move $t0, $sp
+lw $t1, -2548($sp)
+add $t8, $t0, $t1
+lw $t1, -2552($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -2556($sp)
+lw $t1, -520($sp)
+lw $t2, -2556($sp)
+slt $t0, $t1, $t2
+sw $t0, -2560($sp)
+lw $t0, -2560($sp)
+beqz $t0, label122
+lw $t1, -520($sp)
+sw $t1, -524($sp)
+b label123
+label122:
+label123:
+lw $t0, -524($sp)
+# bounds check on a[v123] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2564($sp)
+li $t0, 1
+sw $t0, -2568($sp)
+move $t0, $sp
+lw $t1, -2564($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2568($sp)
+add $t0, $t1, $t2
+sw $t0, -2572($sp)
+move $t0, $sp
+lw $t1, -2564($sp)
+add $t3, $t0, $t1
+lw $t1, -2572($sp)
+sw $t1, ($t3)
+lw $t1, -524($sp)
+sw $t1, -528($sp)
+lw $t0, -528($sp)
+# bounds check on a[v124] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2576($sp)
+move $t0, $sp
+lw $t1, -2576($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2568($sp)
+add $t0, $t1, $t2
+sw $t0, -2580($sp)
+move $t0, $sp
+lw $t1, -2576($sp)
+add $t5, $t0, $t1
+lw $t1, -2580($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -2584($sp)
+lw $t1, -528($sp)
+lw $t2, -2584($sp)
+slt $t0, $t1, $t2
+sw $t0, -2588($sp)
+lw $t0, -2588($sp)
+beqz $t0, label124
+lw $t1, -528($sp)
+sw $t1, -532($sp)
+b label125
+label124:
+label125:
+lw $t0, -532($sp)
+# bounds check on a[v125] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2592($sp)
+li $t0, 1
+sw $t0, -2596($sp)
+move $t0, $sp
+lw $t1, -2592($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2596($sp)
+add $t0, $t1, $t2
+sw $t0, -2600($sp)
+move $t0, $sp
+lw $t1, -2592($sp)
+add $t7, $t0, $t1
+lw $t1, -2600($sp)
+sw $t1, ($t7)
+lw $t1, -532($sp)
+sw $t1, -536($sp)
+lw $t0, -536($sp)
+# bounds check on a[v126] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2604($sp)
+move $t0, $sp
+lw $t1, -2604($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2596($sp)
+add $t0, $t1, $t2
+sw $t0, -2608($sp)
+move $t0, $sp
+lw $t1, -2604($sp)
+add $t9, $t0, $t1
+lw $t1, -2608($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -2612($sp)
+lw $t1, -536($sp)
+lw $t2, -2612($sp)
+slt $t0, $t1, $t2
+sw $t0, -2616($sp)
+lw $t0, -2616($sp)
+beqz $t0, label126
+lw $t1, -536($sp)
+sw $t1, -540($sp)
+b label127
+label126:
+label127:
+lw $t0, -540($sp)
+# bounds check on a[v127] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2620($sp)
+li $t0, 1
+sw $t0, -2624($sp)
+move $t0, $sp
+lw $t1, -2620($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2624($sp)
+add $t0, $t1, $t2
+sw $t0, -2628($sp)
+move $t0, $sp
+lw $t1, -2620($sp)
+add $t4, $t0, $t1
+lw $t1, -2628($sp)
+sw $t1, ($t4)
+lw $t1, -540($sp)
+sw $t1, -544($sp)
+lw $t0, -544($sp)
+# bounds check on a[v128] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2632($sp)
+move $t0, $sp
+lw $t1, -2632($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2624($sp)
+add $t0, $t1, $t2
+sw $t0, -2636($sp)
+move $t0, $sp
+lw $t1, -2632($sp)
+add $t6, $t0, $t1
+lw $t1, -2636($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -2640($sp)
+lw $t1, -544($sp)
+lw $t2, -2640($sp)
+slt $t0, $t1, $t2
+sw $t0, -2644($sp)
+lw $t0, -2644($sp)
+beqz $t0, label128
+lw $t1, -544($sp)
+sw $t1, -548($sp)
+b label129
+label128:
+label129:
+lw $t0, -548($sp)
+# bounds check on a[v129] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2648($sp)
+li $t0, 1
+sw $t0, -2652($sp)
+move $t0, $sp
+lw $t1, -2648($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2652($sp)
+add $t0, $t1, $t2
+sw $t0, -2656($sp)
+move $t0, $sp
+lw $t1, -2648($sp)
+add $t8, $t0, $t1
+lw $t1, -2656($sp)
+sw $t1, ($t8)
+lw $t1, -548($sp)
+sw $t1, -552($sp)
+lw $t0, -552($sp)
+# bounds check on a[v130] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2660($sp)
+move $t0, $sp
+lw $t1, -2660($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2652($sp)
+add $t0, $t1, $t2
+sw $t0, -2664($sp)
+move $t0, $sp
+lw $t1, -2660($sp)
+add $t3, $t0, $t1
+lw $t1, -2664($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -2668($sp)
+lw $t1, -552($sp)
+lw $t2, -2668($sp)
+slt $t0, $t1, $t2
+sw $t0, -2672($sp)
+lw $t0, -2672($sp)
+beqz $t0, label130
+lw $t1, -552($sp)
+sw $t1, -556($sp)
+b label131
+label130:
+label131:
+lw $t0, -556($sp)
+# bounds check on a[v131] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2676($sp)
+li $t0, 1
+sw $t0, -2680($sp)
+move $t0, $sp
+lw $t1, -2676($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2680($sp)
+add $t0, $t1, $t2
+sw $t0, -2684($sp)
+move $t0, $sp
+lw $t1, -2676($sp)
+add $t5, $t0, $t1
+lw $t1, -2684($sp)
+sw $t1, ($t5)
+lw $t1, -556($sp)
+sw $t1, -560($sp)
+lw $t0, -560($sp)
+# bounds check on a[v132] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2688($sp)
+move $t0, $sp
+lw $t1, -2688($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2680($sp)
+add $t0, $t1, $t2
+sw $t0, -2692($sp)
+move $t0, $sp
+lw $t1, -2688($sp)
+add $t7, $t0, $t1
+lw $t1, -2692($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -2696($sp)
+lw $t1, -560($sp)
+lw $t2, -2696($sp)
+slt $t0, $t1, $t2
+sw $t0, -2700($sp)
+lw $t0, -2700($sp)
+beqz $t0, label132
+lw $t1, -560($sp)
+sw $t1, -564($sp)
+b label133
+label132:
+label133:
+lw $t0, -564($sp)
+# bounds check on a[v133] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2704($sp)
+li $t0, 1
+sw $t0, -2708($sp)
+move $t0, $sp
+lw $t1, -2704($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2708($sp)
+add $t0, $t1, $t2
+sw $t0, -2712($sp)
+move $t0, $sp
+lw $t1, -2704($sp)
+add $t9, $t0, $t1
+lw $t1, -2712($sp)
+sw $t1, ($t9)
+lw $t1, -564($sp)
+sw $t1, -568($sp)
+lw $t0, -568($sp)
+# bounds check on a[v134] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2716($sp)
+move $t0, $sp
+lw $t1, -2716($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2708($sp)
+add $t0, $t1, $t2
+sw $t0, -2720($sp)
+move $t0, $sp
+lw $t1, -2716($sp)
+add $t4, $t0, $t1
+lw $t1, -2720($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -2724($sp)
+lw $t1, -568($sp)
+lw $t2, -2724($sp)
+slt $t0, $t1, $t2
+sw $t0, -2728($sp)
+lw $t0, -2728($sp)
+beqz $t0, label134
+lw $t1, -568($sp)
+sw $t1, -572($sp)
+b label135
+label134:
+label135:
+lw $t0, -572($sp)
+# bounds check on a[v135] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2732($sp)
+li $t0, 1
+sw $t0, -2736($sp)
+move $t0, $sp
+lw $t1, -2732($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2736($sp)
+add $t0, $t1, $t2
+sw $t0, -2740($sp)
+move $t0, $sp
+lw $t1, -2732($sp)
+add $t6, $t0, $t1
+lw $t1, -2740($sp)
+sw $t1, ($t6)
+lw $t1, -572($sp)
+sw $t1, -576($sp)
+lw $t0, -576($sp)
+# bounds check on a[v136] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2744($sp)
+move $t0, $sp
+lw $t1, -2744($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2736($sp)
+add $t0, $t1, $t2
+sw $t0, -2748($sp)
+move $t0, $sp
+lw $t1, -2744($sp)
+add $t8, $t0, $t1
+lw $t1, -2748($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -2752($sp)
+lw $t1, -576($sp)
+lw $t2, -2752($sp)
+slt $t0, $t1, $t2
+sw $t0, -2756($sp)
+lw $t0, -2756($sp)
+beqz $t0, label136
+lw $t1, -576($sp)
+sw $t1, -580($sp)
+b label137
+label136:
+label137:
+lw $t0, -580($sp)
+# bounds check on a[v137] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2760($sp)
+li $t0, 1
+sw $t0, -2764($sp)
+move $t0, $sp
+lw $t1, -2760($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2764($sp)
+add $t0, $t1, $t2
+sw $t0, -2768($sp)
+move $t0, $sp
+lw $t1, -2760($sp)
+add $t3, $t0, $t1
+lw $t1, -2768($sp)
+sw $t1, ($t3)
+lw $t1, -580($sp)
+sw $t1, -584($sp)
+lw $t0, -584($sp)
+# bounds check on a[v138] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2772($sp)
+move $t0, $sp
+lw $t1, -2772($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2764($sp)
+add $t0, $t1, $t2
+sw $t0, -2776($sp)
+move $t0, $sp
+lw $t1, -2772($sp)
+add $t5, $t0, $t1
+lw $t1, -2776($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -2780($sp)
+lw $t1, -584($sp)
+lw $t2, -2780($sp)
+slt $t0, $t1, $t2
+sw $t0, -2784($sp)
+lw $t0, -2784($sp)
+beqz $t0, label138
+lw $t1, -584($sp)
+sw $t1, -588($sp)
+b label139
+label138:
+label139:
+lw $t0, -588($sp)
+# bounds check on a[v139] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2788($sp)
+li $t0, 1
+sw $t0, -2792($sp)
+move $t0, $sp
+lw $t1, -2788($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2792($sp)
+add $t0, $t1, $t2
+sw $t0, -2796($sp)
+move $t0, $sp
+lw $t1, -2788($sp)
+add $t7, $t0, $t1
+lw $t1, -2796($sp)
+sw $t1, ($t7)
+lw $t1, -588($sp)
+sw $t1, -592($sp)
+lw $t0, -592($sp)
+# bounds check on a[v140] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2800($sp)
+move $t0, $sp
+lw $t1, -2800($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2792($sp)
+add $t0, $t1, $t2
+sw $t0, -2804($sp)
+move $t0, $sp
+lw $t1, -2800($sp)
+add $t9, $t0, $t1
+lw $t1, -2804($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -2808($sp)
+lw $t1, -592($sp)
+lw $t2, -2808($sp)
+slt $t0, $t1, $t2
+sw $t0, -2812($sp)
+lw $t0, -2812($sp)
+beqz $t0, label140
+lw $t1, -592($sp)
+sw $t1, -596($sp)
+b label141
+label140:
+label141:
+lw $t0, -596($sp)
+# bounds check on a[v141] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2816($sp)
+li $t0, 1
+sw $t0, -2820($sp)
+move $t0, $sp
+lw $t1, -2816($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2820($sp)
+add $t0, $t1, $t2
+sw $t0, -2824($sp)
+move $t0, $sp
+lw $t1, -2816($sp)
+add $t4, $t0, $t1
+lw $t1, -2824($sp)
+sw $t1, ($t4)
+lw $t1, -596($sp)
+sw $t1, -600($sp)
+lw $t0, -600($sp)
+# bounds check on a[v142] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2828($sp)
+move $t0, $sp
+lw $t1, -2828($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2820($sp)
+add $t0, $t1, $t2
+sw $t0, -2832($sp)
+move $t0, $sp
+lw $t1, -2828($sp)
+add $t6, $t0, $t1
+lw $t1, -2832($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -2836($sp)
+lw $t1, -600($sp)
+lw $t2, -2836($sp)
+slt $t0, $t1, $t2
+sw $t0, -2840($sp)
+lw $t0, -2840($sp)
+beqz $t0, label142
+lw $t1, -600($sp)
+sw $t1, -604($sp)
+b label143
+label142:
+label143:
+lw $t0, -604($sp)
+# bounds check on a[v143] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2844($sp)
+li $t0, 1
+sw $t0, -2848($sp)
+move $t0, $sp
+lw $t1, -2844($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2848($sp)
+add $t0, $t1, $t2
+sw $t0, -2852($sp)
+move $t0, $sp
+lw $t1, -2844($sp)
+add $t8, $t0, $t1
+lw $t1, -2852($sp)
+sw $t1, ($t8)
+lw $t1, -604($sp)
+sw $t1, -608($sp)
+lw $t0, -608($sp)
+# bounds check on a[v144] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2856($sp)
+move $t0, $sp
+lw $t1, -2856($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2848($sp)
+add $t0, $t1, $t2
+sw $t0, -2860($sp)
+move $t0, $sp
+lw $t1, -2856($sp)
+add $t3, $t0, $t1
+lw $t1, -2860($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -2864($sp)
+lw $t1, -608($sp)
+lw $t2, -2864($sp)
+slt $t0, $t1, $t2
+sw $t0, -2868($sp)
+lw $t0, -2868($sp)
+beqz $t0, label144
+lw $t1, -608($sp)
+sw $t1, -612($sp)
+b label145
+label144:
+label145:
+lw $t0, -612($sp)
+# bounds check on a[v145] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2872($sp)
+li $t0, 1
+sw $t0, -2876($sp)
+move $t0, $sp
+lw $t1, -2872($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2876($sp)
+add $t0, $t1, $t2
+sw $t0, -2880($sp)
+move $t0, $sp
+lw $t1, -2872($sp)
+add $t5, $t0, $t1
+lw $t1, -2880($sp)
+sw $t1, ($t5)
+lw $t1, -612($sp)
+sw $t1, -616($sp)
+lw $t0, -616($sp)
+# bounds check on a[v146] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2884($sp)
+move $t0, $sp
+lw $t1, -2884($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2876($sp)
+add $t0, $t1, $t2
+sw $t0, -2888($sp)
+move $t0, $sp
+lw $t1, -2884($sp)
+add $t7, $t0, $t1
+lw $t1, -2888($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -2892($sp)
+lw $t1, -616($sp)
+lw $t2, -2892($sp)
+slt $t0, $t1, $t2
+sw $t0, -2896($sp)
+lw $t0, -2896($sp)
+beqz $t0, label146
+lw $t1, -616($sp)
+sw $t1, -620($sp)
+b label147
+label146:
+label147:
+lw $t0, -620($sp)
+# bounds check on a[v147] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2900($sp)
+li $t0, 1
+sw $t0, -2904($sp)
+move $t0, $sp
+lw $t1, -2900($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2904($sp)
+add $t0, $t1, $t2
+sw $t0, -2908($sp)
+move $t0, $sp
+lw $t1, -2900($sp)
+add $t9, $t0, $t1
+lw $t1, -2908($sp)
+sw $t1, ($t9)
+lw $t1, -620($sp)
+sw $t1, -624($sp)
+lw $t0, -624($sp)
+# bounds check on a[v148] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2912($sp)
+move $t0, $sp
+lw $t1, -2912($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -2904($sp)
+add $t0, $t1, $t2
+sw $t0, -2916($sp)
+move $t0, $sp
+lw $t1, -2912($sp)
+add $t4, $t0, $t1
+lw $t1, -2916($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -2920($sp)
+lw $t1, -624($sp)
+lw $t2, -2920($sp)
+slt $t0, $t1, $t2
+sw $t0, -2924($sp)
+lw $t0, -2924($sp)
+beqz $t0, label148
+lw $t1, -624($sp)
+sw $t1, -628($sp)
+b label149
+label148:
+label149:
+lw $t0, -628($sp)
+# bounds check on a[v149] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2928($sp)
+li $t0, 1
+sw $t0, -2932($sp)
+move $t0, $sp
+lw $t1, -2928($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -2932($sp)
+add $t0, $t1, $t2
+sw $t0, -2936($sp)
+move $t0, $sp
+lw $t1, -2928($sp)
+add $t6, $t0, $t1
+lw $t1, -2936($sp)
+sw $t1, ($t6)
+lw $t1, -628($sp)
+sw $t1, -632($sp)
+lw $t0, -632($sp)
+# bounds check on a[v150] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2940($sp)
+move $t0, $sp
+lw $t1, -2940($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -2932($sp)
+add $t0, $t1, $t2
+sw $t0, -2944($sp)
+move $t0, $sp
+lw $t1, -2940($sp)
+add $t8, $t0, $t1
+lw $t1, -2944($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -2948($sp)
+lw $t1, -632($sp)
+lw $t2, -2948($sp)
+slt $t0, $t1, $t2
+sw $t0, -2952($sp)
+lw $t0, -2952($sp)
+beqz $t0, label150
+lw $t1, -632($sp)
+sw $t1, -636($sp)
+b label151
+label150:
+label151:
+lw $t0, -636($sp)
+# bounds check on a[v151] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2956($sp)
+li $t0, 1
+sw $t0, -2960($sp)
+move $t0, $sp
+lw $t1, -2956($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -2960($sp)
+add $t0, $t1, $t2
+sw $t0, -2964($sp)
+move $t0, $sp
+lw $t1, -2956($sp)
+add $t3, $t0, $t1
+lw $t1, -2964($sp)
+sw $t1, ($t3)
+lw $t1, -636($sp)
+sw $t1, -640($sp)
+lw $t0, -640($sp)
+# bounds check on a[v152] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2968($sp)
+move $t0, $sp
+lw $t1, -2968($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -2960($sp)
+add $t0, $t1, $t2
+sw $t0, -2972($sp)
+move $t0, $sp
+lw $t1, -2968($sp)
+add $t5, $t0, $t1
+lw $t1, -2972($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -2976($sp)
+lw $t1, -640($sp)
+lw $t2, -2976($sp)
+slt $t0, $t1, $t2
+sw $t0, -2980($sp)
+lw $t0, -2980($sp)
+beqz $t0, label152
+lw $t1, -640($sp)
+sw $t1, -644($sp)
+b label153
+label152:
+label153:
+lw $t0, -644($sp)
+# bounds check on a[v153] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2984($sp)
+li $t0, 1
+sw $t0, -2988($sp)
+move $t0, $sp
+lw $t1, -2984($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -2988($sp)
+add $t0, $t1, $t2
+sw $t0, -2992($sp)
+move $t0, $sp
+lw $t1, -2984($sp)
+add $t7, $t0, $t1
+lw $t1, -2992($sp)
+sw $t1, ($t7)
+lw $t1, -644($sp)
+sw $t1, -648($sp)
+lw $t0, -648($sp)
+# bounds check on a[v154] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -2996($sp)
+move $t0, $sp
+lw $t1, -2996($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -2988($sp)
+add $t0, $t1, $t2
+sw $t0, -3000($sp)
+move $t0, $sp
+lw $t1, -2996($sp)
+add $t9, $t0, $t1
+lw $t1, -3000($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -3004($sp)
+lw $t1, -648($sp)
+lw $t2, -3004($sp)
+slt $t0, $t1, $t2
+sw $t0, -3008($sp)
+lw $t0, -3008($sp)
+beqz $t0, label154
+lw $t1, -648($sp)
+sw $t1, -652($sp)
+b label155
+label154:
+label155:
+lw $t0, -652($sp)
+# bounds check on a[v155] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3012($sp)
+li $t0, 1
+sw $t0, -3016($sp)
+move $t0, $sp
+lw $t1, -3012($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3016($sp)
+add $t0, $t1, $t2
+sw $t0, -3020($sp)
+move $t0, $sp
+lw $t1, -3012($sp)
+add $t4, $t0, $t1
+lw $t1, -3020($sp)
+sw $t1, ($t4)
+lw $t1, -652($sp)
+sw $t1, -656($sp)
+lw $t0, -656($sp)
+# bounds check on a[v156] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3024($sp)
+move $t0, $sp
+lw $t1, -3024($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3016($sp)
+add $t0, $t1, $t2
+sw $t0, -3028($sp)
+move $t0, $sp
+lw $t1, -3024($sp)
+add $t6, $t0, $t1
+lw $t1, -3028($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -3032($sp)
+lw $t1, -656($sp)
+lw $t2, -3032($sp)
+slt $t0, $t1, $t2
+sw $t0, -3036($sp)
+lw $t0, -3036($sp)
+beqz $t0, label156
+lw $t1, -656($sp)
+sw $t1, -660($sp)
+b label157
+label156:
+label157:
+lw $t0, -660($sp)
+# bounds check on a[v157] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3040($sp)
+li $t0, 1
+sw $t0, -3044($sp)
+move $t0, $sp
+lw $t1, -3040($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3044($sp)
+add $t0, $t1, $t2
+sw $t0, -3048($sp)
+move $t0, $sp
+lw $t1, -3040($sp)
+add $t8, $t0, $t1
+lw $t1, -3048($sp)
+sw $t1, ($t8)
+lw $t1, -660($sp)
+sw $t1, -664($sp)
+lw $t0, -664($sp)
+# bounds check on a[v158] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3052($sp)
+move $t0, $sp
+lw $t1, -3052($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3044($sp)
+add $t0, $t1, $t2
+sw $t0, -3056($sp)
+move $t0, $sp
+lw $t1, -3052($sp)
+add $t3, $t0, $t1
+lw $t1, -3056($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -3060($sp)
+lw $t1, -664($sp)
+lw $t2, -3060($sp)
+slt $t0, $t1, $t2
+sw $t0, -3064($sp)
+lw $t0, -3064($sp)
+beqz $t0, label158
+lw $t1, -664($sp)
+sw $t1, -668($sp)
+b label159
+label158:
+label159:
+lw $t0, -668($sp)
+# bounds check on a[v159] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3068($sp)
+li $t0, 1
+sw $t0, -3072($sp)
+move $t0, $sp
+lw $t1, -3068($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -3072($sp)
+add $t0, $t1, $t2
+sw $t0, -3076($sp)
+move $t0, $sp
+lw $t1, -3068($sp)
+add $t5, $t0, $t1
+lw $t1, -3076($sp)
+sw $t1, ($t5)
+lw $t1, -668($sp)
+sw $t1, -672($sp)
+lw $t0, -672($sp)
+# bounds check on a[v160] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3080($sp)
+move $t0, $sp
+lw $t1, -3080($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -3072($sp)
+add $t0, $t1, $t2
+sw $t0, -3084($sp)
+move $t0, $sp
+lw $t1, -3080($sp)
+add $t7, $t0, $t1
+lw $t1, -3084($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -3088($sp)
+lw $t1, -672($sp)
+lw $t2, -3088($sp)
+slt $t0, $t1, $t2
+sw $t0, -3092($sp)
+lw $t0, -3092($sp)
+beqz $t0, label160
+lw $t1, -672($sp)
+sw $t1, -676($sp)
+b label161
+label160:
+label161:
+lw $t0, -676($sp)
+# bounds check on a[v161] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3096($sp)
+li $t0, 1
+sw $t0, -3100($sp)
+move $t0, $sp
+lw $t1, -3096($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -3100($sp)
+add $t0, $t1, $t2
+sw $t0, -3104($sp)
+move $t0, $sp
+lw $t1, -3096($sp)
+add $t9, $t0, $t1
+lw $t1, -3104($sp)
+sw $t1, ($t9)
+lw $t1, -676($sp)
+sw $t1, -680($sp)
+lw $t0, -680($sp)
+# bounds check on a[v162] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3108($sp)
+move $t0, $sp
+lw $t1, -3108($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3100($sp)
+add $t0, $t1, $t2
+sw $t0, -3112($sp)
+move $t0, $sp
+lw $t1, -3108($sp)
+add $t4, $t0, $t1
+lw $t1, -3112($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -3116($sp)
+lw $t1, -680($sp)
+lw $t2, -3116($sp)
+slt $t0, $t1, $t2
+sw $t0, -3120($sp)
+lw $t0, -3120($sp)
+beqz $t0, label162
+lw $t1, -680($sp)
+sw $t1, -684($sp)
+b label163
+label162:
+label163:
+lw $t0, -684($sp)
+# bounds check on a[v163] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3124($sp)
+li $t0, 1
+sw $t0, -3128($sp)
+move $t0, $sp
+lw $t1, -3124($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3128($sp)
+add $t0, $t1, $t2
+sw $t0, -3132($sp)
+move $t0, $sp
+lw $t1, -3124($sp)
+add $t6, $t0, $t1
+lw $t1, -3132($sp)
+sw $t1, ($t6)
+lw $t1, -684($sp)
+sw $t1, -688($sp)
+lw $t0, -688($sp)
+# bounds check on a[v164] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3136($sp)
+move $t0, $sp
+lw $t1, -3136($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3128($sp)
+add $t0, $t1, $t2
+sw $t0, -3140($sp)
+move $t0, $sp
+lw $t1, -3136($sp)
+add $t8, $t0, $t1
+lw $t1, -3140($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -3144($sp)
+lw $t1, -688($sp)
+lw $t2, -3144($sp)
+slt $t0, $t1, $t2
+sw $t0, -3148($sp)
+lw $t0, -3148($sp)
+beqz $t0, label164
+lw $t1, -688($sp)
+sw $t1, -692($sp)
+b label165
+label164:
+label165:
+lw $t0, -692($sp)
+# bounds check on a[v165] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3152($sp)
+li $t0, 1
+sw $t0, -3156($sp)
+move $t0, $sp
+lw $t1, -3152($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3156($sp)
+add $t0, $t1, $t2
+sw $t0, -3160($sp)
+move $t0, $sp
+lw $t1, -3152($sp)
+add $t3, $t0, $t1
+lw $t1, -3160($sp)
+sw $t1, ($t3)
+lw $t1, -692($sp)
+sw $t1, -696($sp)
+lw $t0, -696($sp)
+# bounds check on a[v166] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3164($sp)
+move $t0, $sp
+lw $t1, -3164($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -3156($sp)
+add $t0, $t1, $t2
+sw $t0, -3168($sp)
+move $t0, $sp
+lw $t1, -3164($sp)
+add $t5, $t0, $t1
+lw $t1, -3168($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -3172($sp)
+lw $t1, -696($sp)
+lw $t2, -3172($sp)
+slt $t0, $t1, $t2
+sw $t0, -3176($sp)
+lw $t0, -3176($sp)
+beqz $t0, label166
+lw $t1, -696($sp)
+sw $t1, -700($sp)
+b label167
+label166:
+label167:
+lw $t0, -700($sp)
+# bounds check on a[v167] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3180($sp)
+li $t0, 1
+sw $t0, -3184($sp)
+move $t0, $sp
+lw $t1, -3180($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -3184($sp)
+add $t0, $t1, $t2
+sw $t0, -3188($sp)
+move $t0, $sp
+lw $t1, -3180($sp)
+add $t7, $t0, $t1
+lw $t1, -3188($sp)
+sw $t1, ($t7)
+lw $t1, -700($sp)
+sw $t1, -704($sp)
+lw $t0, -704($sp)
+# bounds check on a[v168] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3192($sp)
+move $t0, $sp
+lw $t1, -3192($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -3184($sp)
+add $t0, $t1, $t2
+sw $t0, -3196($sp)
+move $t0, $sp
+lw $t1, -3192($sp)
+add $t9, $t0, $t1
+lw $t1, -3196($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -3200($sp)
+lw $t1, -704($sp)
+lw $t2, -3200($sp)
+slt $t0, $t1, $t2
+sw $t0, -3204($sp)
+lw $t0, -3204($sp)
+beqz $t0, label168
+lw $t1, -704($sp)
+sw $t1, -708($sp)
+b label169
+label168:
+label169:
+lw $t0, -708($sp)
+# bounds check on a[v169] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3208($sp)
+li $t0, 1
+sw $t0, -3212($sp)
+move $t0, $sp
+lw $t1, -3208($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3212($sp)
+add $t0, $t1, $t2
+sw $t0, -3216($sp)
+move $t0, $sp
+lw $t1, -3208($sp)
+add $t4, $t0, $t1
+lw $t1, -3216($sp)
+sw $t1, ($t4)
+lw $t1, -708($sp)
+sw $t1, -712($sp)
+lw $t0, -712($sp)
+# bounds check on a[v170] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3220($sp)
+move $t0, $sp
+lw $t1, -3220($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3212($sp)
+add $t0, $t1, $t2
+sw $t0, -3224($sp)
+move $t0, $sp
+lw $t1, -3220($sp)
+add $t6, $t0, $t1
+lw $t1, -3224($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -3228($sp)
+lw $t1, -712($sp)
+lw $t2, -3228($sp)
+slt $t0, $t1, $t2
+sw $t0, -3232($sp)
+lw $t0, -3232($sp)
+beqz $t0, label170
+lw $t1, -712($sp)
+sw $t1, -716($sp)
+b label171
+label170:
+label171:
+lw $t0, -716($sp)
+# bounds check on a[v171] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3236($sp)
+li $t0, 1
+sw $t0, -3240($sp)
+move $t0, $sp
+lw $t1, -3236($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3240($sp)
+add $t0, $t1, $t2
+sw $t0, -3244($sp)
+move $t0, $sp
+lw $t1, -3236($sp)
+add $t8, $t0, $t1
+lw $t1, -3244($sp)
+sw $t1, ($t8)
+lw $t1, -716($sp)
+sw $t1, -720($sp)
+lw $t0, -720($sp)
+# bounds check on a[v172] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3248($sp)
+move $t0, $sp
+lw $t1, -3248($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3240($sp)
+add $t0, $t1, $t2
+sw $t0, -3252($sp)
+move $t0, $sp
+lw $t1, -3248($sp)
+add $t3, $t0, $t1
+lw $t1, -3252($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -3256($sp)
+lw $t1, -720($sp)
+lw $t2, -3256($sp)
+slt $t0, $t1, $t2
+sw $t0, -3260($sp)
+lw $t0, -3260($sp)
+beqz $t0, label172
+lw $t1, -720($sp)
+sw $t1, -724($sp)
+b label173
+label172:
+label173:
+lw $t0, -724($sp)
+# bounds check on a[v173] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3264($sp)
+li $t0, 1
+sw $t0, -3268($sp)
+move $t0, $sp
+lw $t1, -3264($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -3268($sp)
+add $t0, $t1, $t2
+sw $t0, -3272($sp)
+move $t0, $sp
+lw $t1, -3264($sp)
+add $t5, $t0, $t1
+lw $t1, -3272($sp)
+sw $t1, ($t5)
+lw $t1, -724($sp)
+sw $t1, -728($sp)
+lw $t0, -728($sp)
+# bounds check on a[v174] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3276($sp)
+move $t0, $sp
+lw $t1, -3276($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -3268($sp)
+add $t0, $t1, $t2
+sw $t0, -3280($sp)
+move $t0, $sp
+lw $t1, -3276($sp)
+add $t7, $t0, $t1
+lw $t1, -3280($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -3284($sp)
+lw $t1, -728($sp)
+lw $t2, -3284($sp)
+slt $t0, $t1, $t2
+sw $t0, -3288($sp)
+lw $t0, -3288($sp)
+beqz $t0, label174
+lw $t1, -728($sp)
+sw $t1, -732($sp)
+b label175
+label174:
+label175:
+lw $t0, -732($sp)
+# bounds check on a[v175] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3292($sp)
+li $t0, 1
+sw $t0, -3296($sp)
+move $t0, $sp
+lw $t1, -3292($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -3296($sp)
+add $t0, $t1, $t2
+sw $t0, -3300($sp)
+move $t0, $sp
+lw $t1, -3292($sp)
+add $t9, $t0, $t1
+lw $t1, -3300($sp)
+sw $t1, ($t9)
+lw $t1, -732($sp)
+sw $t1, -736($sp)
+lw $t0, -736($sp)
+# bounds check on a[v176] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3304($sp)
+move $t0, $sp
+lw $t1, -3304($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3296($sp)
+add $t0, $t1, $t2
+sw $t0, -3308($sp)
+move $t0, $sp
+lw $t1, -3304($sp)
+add $t4, $t0, $t1
+lw $t1, -3308($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -3312($sp)
+lw $t1, -736($sp)
+lw $t2, -3312($sp)
+slt $t0, $t1, $t2
+sw $t0, -3316($sp)
+lw $t0, -3316($sp)
+beqz $t0, label176
+lw $t1, -736($sp)
+sw $t1, -740($sp)
+b label177
+label176:
+label177:
+lw $t0, -740($sp)
+# bounds check on a[v177] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3320($sp)
+li $t0, 1
+sw $t0, -3324($sp)
+move $t0, $sp
+lw $t1, -3320($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3324($sp)
+add $t0, $t1, $t2
+sw $t0, -3328($sp)
+move $t0, $sp
+lw $t1, -3320($sp)
+add $t6, $t0, $t1
+lw $t1, -3328($sp)
+sw $t1, ($t6)
+lw $t1, -740($sp)
+sw $t1, -744($sp)
+lw $t0, -744($sp)
+# bounds check on a[v178] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3332($sp)
+move $t0, $sp
+lw $t1, -3332($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3324($sp)
+add $t0, $t1, $t2
+sw $t0, -3336($sp)
+move $t0, $sp
+lw $t1, -3332($sp)
+add $t8, $t0, $t1
+lw $t1, -3336($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -3340($sp)
+lw $t1, -744($sp)
+lw $t2, -3340($sp)
+slt $t0, $t1, $t2
+sw $t0, -3344($sp)
+lw $t0, -3344($sp)
+beqz $t0, label178
+lw $t1, -744($sp)
+sw $t1, -748($sp)
+b label179
+label178:
+label179:
+lw $t0, -748($sp)
+# bounds check on a[v179] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3348($sp)
+li $t0, 1
+sw $t0, -3352($sp)
+move $t0, $sp
+lw $t1, -3348($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3352($sp)
+add $t0, $t1, $t2
+sw $t0, -3356($sp)
+move $t0, $sp
+lw $t1, -3348($sp)
+add $t3, $t0, $t1
+lw $t1, -3356($sp)
+sw $t1, ($t3)
+lw $t1, -748($sp)
+sw $t1, -752($sp)
+lw $t0, -752($sp)
+# bounds check on a[v180] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3360($sp)
+move $t0, $sp
+lw $t1, -3360($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -3352($sp)
+add $t0, $t1, $t2
+sw $t0, -3364($sp)
+move $t0, $sp
+lw $t1, -3360($sp)
+add $t5, $t0, $t1
+lw $t1, -3364($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -3368($sp)
+lw $t1, -752($sp)
+lw $t2, -3368($sp)
+slt $t0, $t1, $t2
+sw $t0, -3372($sp)
+lw $t0, -3372($sp)
+beqz $t0, label180
+lw $t1, -752($sp)
+sw $t1, -756($sp)
+b label181
+label180:
+label181:
+lw $t0, -756($sp)
+# bounds check on a[v181] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3376($sp)
+li $t0, 1
+sw $t0, -3380($sp)
+move $t0, $sp
+lw $t1, -3376($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -3380($sp)
+add $t0, $t1, $t2
+sw $t0, -3384($sp)
+move $t0, $sp
+lw $t1, -3376($sp)
+add $t7, $t0, $t1
+lw $t1, -3384($sp)
+sw $t1, ($t7)
+lw $t1, -756($sp)
+sw $t1, -760($sp)
+lw $t0, -760($sp)
+# bounds check on a[v182] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3388($sp)
+move $t0, $sp
+lw $t1, -3388($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -3380($sp)
+add $t0, $t1, $t2
+sw $t0, -3392($sp)
+move $t0, $sp
+lw $t1, -3388($sp)
+add $t9, $t0, $t1
+lw $t1, -3392($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -3396($sp)
+lw $t1, -760($sp)
+lw $t2, -3396($sp)
+slt $t0, $t1, $t2
+sw $t0, -3400($sp)
+lw $t0, -3400($sp)
+beqz $t0, label182
+lw $t1, -760($sp)
+sw $t1, -764($sp)
+b label183
+label182:
+label183:
+lw $t0, -764($sp)
+# bounds check on a[v183] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3404($sp)
+li $t0, 1
+sw $t0, -3408($sp)
+move $t0, $sp
+lw $t1, -3404($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3408($sp)
+add $t0, $t1, $t2
+sw $t0, -3412($sp)
+move $t0, $sp
+lw $t1, -3404($sp)
+add $t4, $t0, $t1
+lw $t1, -3412($sp)
+sw $t1, ($t4)
+lw $t1, -764($sp)
+sw $t1, -768($sp)
+lw $t0, -768($sp)
+# bounds check on a[v184] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3416($sp)
+move $t0, $sp
+lw $t1, -3416($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3408($sp)
+add $t0, $t1, $t2
+sw $t0, -3420($sp)
+move $t0, $sp
+lw $t1, -3416($sp)
+add $t6, $t0, $t1
+lw $t1, -3420($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -3424($sp)
+lw $t1, -768($sp)
+lw $t2, -3424($sp)
+slt $t0, $t1, $t2
+sw $t0, -3428($sp)
+lw $t0, -3428($sp)
+beqz $t0, label184
+lw $t1, -768($sp)
+sw $t1, -772($sp)
+b label185
+label184:
+label185:
+lw $t0, -772($sp)
+# bounds check on a[v185] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3432($sp)
+li $t0, 1
+sw $t0, -3436($sp)
+move $t0, $sp
+lw $t1, -3432($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3436($sp)
+add $t0, $t1, $t2
+sw $t0, -3440($sp)
+move $t0, $sp
+lw $t1, -3432($sp)
+add $t8, $t0, $t1
+lw $t1, -3440($sp)
+sw $t1, ($t8)
+lw $t1, -772($sp)
+sw $t1, -776($sp)
+lw $t0, -776($sp)
+# bounds check on a[v186] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3444($sp)
+move $t0, $sp
+lw $t1, -3444($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3436($sp)
+add $t0, $t1, $t2
+sw $t0, -3448($sp)
+move $t0, $sp
+lw $t1, -3444($sp)
+add $t3, $t0, $t1
+lw $t1, -3448($sp)
+sw $t1, ($t3)
+li $t0, 8
+sw $t0, -3452($sp)
+lw $t1, -776($sp)
+lw $t2, -3452($sp)
+slt $t0, $t1, $t2
+sw $t0, -3456($sp)
+lw $t0, -3456($sp)
+beqz $t0, label186
+lw $t1, -776($sp)
+sw $t1, -780($sp)
+b label187
+label186:
+label187:
+lw $t0, -780($sp)
+# bounds check on a[v187] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3460($sp)
+li $t0, 1
+sw $t0, -3464($sp)
+move $t0, $sp
+lw $t1, -3460($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -3464($sp)
+add $t0, $t1, $t2
+sw $t0, -3468($sp)
+move $t0, $sp
+lw $t1, -3460($sp)
+add $t5, $t0, $t1
+lw $t1, -3468($sp)
+sw $t1, ($t5)
+lw $t1, -780($sp)
+sw $t1, -784($sp)
+lw $t0, -784($sp)
+# bounds check on a[v188] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3472($sp)
+move $t0, $sp
+lw $t1, -3472($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -3464($sp)
+add $t0, $t1, $t2
+sw $t0, -3476($sp)
+move $t0, $sp
+lw $t1, -3472($sp)
+add $t7, $t0, $t1
+lw $t1, -3476($sp)
+sw $t1, ($t7)
+li $t0, 8
+sw $t0, -3480($sp)
+lw $t1, -784($sp)
+lw $t2, -3480($sp)
+slt $t0, $t1, $t2
+sw $t0, -3484($sp)
+lw $t0, -3484($sp)
+beqz $t0, label188
+lw $t1, -784($sp)
+sw $t1, -788($sp)
+b label189
+label188:
+label189:
+lw $t0, -788($sp)
+# bounds check on a[v189] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3488($sp)
+li $t0, 1
+sw $t0, -3492($sp)
+move $t0, $sp
+lw $t1, -3488($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -3492($sp)
+add $t0, $t1, $t2
+sw $t0, -3496($sp)
+move $t0, $sp
+lw $t1, -3488($sp)
+add $t9, $t0, $t1
+lw $t1, -3496($sp)
+sw $t1, ($t9)
+lw $t1, -788($sp)
+sw $t1, -792($sp)
+lw $t0, -792($sp)
+# bounds check on a[v190] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3500($sp)
+move $t0, $sp
+lw $t1, -3500($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3492($sp)
+add $t0, $t1, $t2
+sw $t0, -3504($sp)
+move $t0, $sp
+lw $t1, -3500($sp)
+add $t4, $t0, $t1
+lw $t1, -3504($sp)
+sw $t1, ($t4)
+li $t0, 8
+sw $t0, -3508($sp)
+lw $t1, -792($sp)
+lw $t2, -3508($sp)
+slt $t0, $t1, $t2
+sw $t0, -3512($sp)
+lw $t0, -3512($sp)
+beqz $t0, label190
+lw $t1, -792($sp)
+sw $t1, -796($sp)
+b label191
+label190:
+label191:
+lw $t0, -796($sp)
+# bounds check on a[v191] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3516($sp)
+li $t0, 1
+sw $t0, -3520($sp)
+move $t0, $sp
+lw $t1, -3516($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3520($sp)
+add $t0, $t1, $t2
+sw $t0, -3524($sp)
+move $t0, $sp
+lw $t1, -3516($sp)
+add $t6, $t0, $t1
+lw $t1, -3524($sp)
+sw $t1, ($t6)
+lw $t1, -796($sp)
+sw $t1, -800($sp)
+lw $t0, -800($sp)
+# bounds check on a[v192] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3528($sp)
+move $t0, $sp
+lw $t1, -3528($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3520($sp)
+add $t0, $t1, $t2
+sw $t0, -3532($sp)
+move $t0, $sp
+lw $t1, -3528($sp)
+add $t8, $t0, $t1
+lw $t1, -3532($sp)
+sw $t1, ($t8)
+li $t0, 8
+sw $t0, -3536($sp)
+lw $t1, -800($sp)
+lw $t2, -3536($sp)
+slt $t0, $t1, $t2
+sw $t0, -3540($sp)
+lw $t0, -3540($sp)
+beqz $t0, label192
+lw $t1, -800($sp)
+sw $t1, -804($sp)
+b label193
+label192:
+label193:
+lw $t0, -804($sp)
+# bounds check on a[v193] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3544($sp)
+li $t0, 1
+sw $t0, -3548($sp)
+move $t0, $sp
+lw $t1, -3544($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3548($sp)
+add $t0, $t1, $t2
+sw $t0, -3552($sp)
+move $t0, $sp
+lw $t1, -3544($sp)
+add $t3, $t0, $t1
+lw $t1, -3552($sp)
+sw $t1, ($t3)
+lw $t1, -804($sp)
+sw $t1, -808($sp)
+lw $t0, -808($sp)
+# bounds check on a[v194] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3556($sp)
+move $t0, $sp
+lw $t1, -3556($sp)
+add $t4, $t0, $t1
+lw $t1, ($t4)
+lw $t2, -3548($sp)
+add $t0, $t1, $t2
+sw $t0, -3560($sp)
+move $t0, $sp
+lw $t1, -3556($sp)
+add $t5, $t0, $t1
+lw $t1, -3560($sp)
+sw $t1, ($t5)
+li $t0, 8
+sw $t0, -3564($sp)
+lw $t1, -808($sp)
+lw $t2, -3564($sp)
+slt $t0, $t1, $t2
+sw $t0, -3568($sp)
+lw $t0, -3568($sp)
+beqz $t0, label194
+lw $t1, -808($sp)
+sw $t1, -812($sp)
+b label195
+label194:
+label195:
+lw $t0, -812($sp)
+# bounds check on a[v195] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3572($sp)
+li $t0, 1
+sw $t0, -3576($sp)
+move $t0, $sp
+lw $t1, -3572($sp)
+add $t6, $t0, $t1
+lw $t1, ($t6)
+lw $t2, -3576($sp)
+add $t0, $t1, $t2
+sw $t0, -3580($sp)
+move $t0, $sp
+lw $t1, -3572($sp)
+add $t7, $t0, $t1
+lw $t1, -3580($sp)
+sw $t1, ($t7)
+lw $t1, -812($sp)
+sw $t1, -816($sp)
+lw $t0, -816($sp)
+# bounds check on a[v196] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3584($sp)
+move $t0, $sp
+lw $t1, -3584($sp)
+add $t8, $t0, $t1
+lw $t1, ($t8)
+lw $t2, -3576($sp)
+add $t0, $t1, $t2
+sw $t0, -3588($sp)
+move $t0, $sp
+lw $t1, -3584($sp)
+add $t9, $t0, $t1
+lw $t1, -3588($sp)
+sw $t1, ($t9)
+li $t0, 8
+sw $t0, -3592($sp)
+lw $t1, -816($sp)
+lw $t2, -3592($sp)
+slt $t0, $t1, $t2
+sw $t0, -3596($sp)
+lw $t0, -3596($sp)
+beqz $t0, label196
+lw $t1, -816($sp)
+sw $t1, -820($sp)
+b label197
+label196:
+label197:
+lw $t0, -820($sp)
+# bounds check on a[v197] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3600($sp)
+li $t0, 1
+sw $t0, -3604($sp)
+move $t0, $sp
+lw $t1, -3600($sp)
+add $t3, $t0, $t1
+lw $t1, ($t3)
+lw $t2, -3604($sp)
+add $t0, $t1, $t2
+sw $t0, -3608($sp)
+move $t0, $sp
+lw $t1, -3600($sp)
+add $t4, $t0, $t1
+lw $t1, -3608($sp)
+sw $t1, ($t4)
+lw $t1, -820($sp)
+sw $t1, -824($sp)
+lw $t0, -824($sp)
+# bounds check on a[v198] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3612($sp)
+move $t0, $sp
+lw $t1, -3612($sp)
+add $t5, $t0, $t1
+lw $t1, ($t5)
+lw $t2, -3604($sp)
+add $t0, $t1, $t2
+sw $t0, -3616($sp)
+move $t0, $sp
+lw $t1, -3612($sp)
+add $t6, $t0, $t1
+lw $t1, -3616($sp)
+sw $t1, ($t6)
+li $t0, 8
+sw $t0, -3620($sp)
+lw $t1, -824($sp)
+lw $t2, -3620($sp)
+slt $t0, $t1, $t2
+sw $t0, -3624($sp)
+lw $t0, -3624($sp)
+beqz $t0, label198
+lw $t1, -824($sp)
+sw $t1, -828($sp)
+b label199
+label198:
+label199:
+lw $t0, -828($sp)
+# bounds check on a[v199] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3628($sp)
+li $t0, 1
+sw $t0, -3632($sp)
+move $t0, $sp
+lw $t1, -3628($sp)
+add $t7, $t0, $t1
+lw $t1, ($t7)
+lw $t2, -3632($sp)
+add $t0, $t1, $t2
+sw $t0, -3636($sp)
+move $t0, $sp
+lw $t1, -3628($sp)
+add $t8, $t0, $t1
+lw $t1, -3636($sp)
+sw $t1, ($t8)
+lw $t1, -828($sp)
+sw $t1, -832($sp)
+lw $t0, -832($sp)
+# bounds check on a[v200] eliminated
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3640($sp)
+move $t0, $sp
+lw $t1, -3640($sp)
+add $t9, $t0, $t1
+lw $t1, ($t9)
+lw $t2, -3632($sp)
+add $t0, $t1, $t2
+sw $t0, -3644($sp)
+move $t0, $sp
+lw $t1, -3640($sp)
+add $t3, $t0, $t1
+lw $t1, -3644($sp)
+sw $t1, ($t3)
+la $a0, str_500
+li $v0, 4
+syscall
+lw $a0, 0($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+li $t0, 8
+sw $t0, -3648($sp)
+lw $t1, -3648($sp)
+sw $t1, -836($sp)
+lw $t1, -836($sp)
+sw $t1, -840($sp)
+lw $t0, -840($sp)
+li $t1, 8
+bgeu $t0, $t1, BoundsError
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -3652($sp)
+li $t0, 0
+sw $t0, -3656($sp)
+move $t0, $sp
+lw $t1, -3652($sp)
+add $t4, $t0, $t1
+lw $t1, -3656($sp)
+sw $t1, ($t4)
+la $a0, str_502
+li $v0, 4
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+
+# Postlog:
+la $a0 ProgEnd
+li $v0 4
+syscall
+li $v0 10
+syscall
+BoundsError:
+la $a0 BoundsMsg
+li $v0 4
+syscall
+li $v0 10
+syscall
+.data
+ProgStart: 	 .asciiz "Program Start\n"
+ProgEnd:   	 .asciiz "Program End\n"
+BoundsMsg: 	 .asciiz "array index out of bounds\n"
+str_500: 		 .asciiz "a[0]: "
+str_502: 		 .asciiz "not reached"
@@ -0,0 +1,168 @@
+# Prolog:
+.text
+main:
+move $fp $sp
+la $a0 ProgStart
+li $v0 4
+syscall
+# End of Prolog
+
+li $t0, 6
+sw $t0, -40($sp)
+lw $t1, -40($sp)
+sw $t1, -20($sp)
+li $t0, 7
+sw $t0, -44($sp)
+lw $t1, -44($sp)
+sw $t1, -24($sp)
+li $t0, 2
+sw $t0, -48($sp)
+lw $t1, -48($sp)
+sw $t1, -28($sp)
+lw $t0, -28($sp)
+add $t0, $t0, $t0
+add $t0, $t0, $t0
+li $t1, 0
+sub $t0, $t1, $t0
+sw $t0, -52($sp)
+li $t0, 10
+sw $t0, -56($sp)
+move $t0, $sp
+lw $t1, -52($sp)
+add $t3, $t0, $t1
+lw $t1, -56($sp)
+sw $t1, ($t3)
+lw $t1, -20($sp)
+lw $t2, -24($sp)
+mult $t1, $t2
+mflo $t0
+sw $t0, -60($sp)
+move $t0, $sp
+lw $t1, -52($sp)
+add $t4, $t0, $t1
+lw $t1, -60($sp)
+lw $t2, ($t4)
+add $t0, $t1, $t2
+sw $t0, -64($sp)
+lw $t1, -64($sp)
+sw $t1, -32($sp)
+move $t0, $sp
+lw $t1, -52($sp)
+add $t5, $t0, $t1
+lw $t1, -60($sp)
+lw $t2, ($t5)
+sub $t0, $t1, $t2
+sw $t0, -68($sp)
+lw $t1, -68($sp)
+sw $t1, -36($sp)
+lw $a0, -32($sp)
+li $v0, 1
+syscall
+la $a0, str_4
+li $v0, 4
+syscall
+lw $a0, -36($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+li $t0, 4
+sw $t0, -72($sp)
+lw $t1, -48($sp)
+lw $t2, -72($sp)
+or $t0, $t1, $t2
+sw $t0, -76($sp)
+lw $t1, -76($sp)
+sw $t1, -32($sp)
+li $t0, 1
+sw $t0, -80($sp)
+lw $t1, -80($sp)
+sw $t1, -36($sp)
+lw $a0, -32($sp)
+li $v0, 1
+syscall
+la $a0, str_6
+li $v0, 4
+syscall
+lw $a0, -36($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+li $t0, 0
+sw $t0, -84($sp)
+lw $t1, -84($sp)
+sw $t1, -28($sp)
+b label0
+label0_body:
+li $t0, 1
+sw $t0, -96($sp)
+lw $t1, -28($sp)
+lw $t2, -96($sp)
+sgt $t0, $t1, $t2
+sw $t0, -100($sp)
+lw $t0, -100($sp)
+beqz $t0, label2
+lw $t1, -20($sp)
+lw $t2, -24($sp)
+mult $t1, $t2
+mflo $t0
+sw $t0, -104($sp)
+lw $t1, -104($sp)
+sw $t1, -32($sp)
+label3:
+li $t0, 1
+sw $t0, -112($sp)
+lw $t1, -28($sp)
+lw $t2, -112($sp)
+add $t0, $t1, $t2
+sw $t0, -116($sp)
+lw $t1, -116($sp)
+sw $t1, -28($sp)
+label0:
+li $t0, 10
+sw $t0, -88($sp)
+lw $t1, -28($sp)
+lw $t2, -88($sp)
+slt $t0, $t1, $t2
+sw $t0, -92($sp)
+lw $t0, -92($sp)
+bnez $t0, label0_body
+label1:
+lw $a0, -32($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+
+# Postlog:
+la $a0 ProgEnd
+li $v0 4
+syscall
+li $v0 10
+syscall
+
+# Cold code:
+label2:
+lw $t1, -20($sp)
+lw $t2, -24($sp)
+mult $t1, $t2
+mflo $t0
+sw $t0, -108($sp)
+lw $t1, -108($sp)
+sw $t1, -36($sp)
+lw $a0, -36($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+b label3
+.data
+ProgStart: 	 .asciiz "Program Start\n"
+ProgEnd:   	 .asciiz "Program End\n"
+str_4: 		 .asciiz " "
+str_6: 		 .asciiz " "
@@ -135,43 +135,35 @@ syscall
 label7:
 li $t0, 0
 sw $t0, -80($sp)
-li $t0, 0
-sw $t0, -84($sp)
 lw $t1, -80($sp)
-lw $t2, -84($sp)
+lw $t2, -80($sp)
+or $t0, $t1, $t2
+sw $t0, -84($sp)
+lw $t1, -84($sp)
+lw $t2, -80($sp)
 or $t0, $t1, $t2
 sw $t0, -88($sp)
-li $t0, 0
+li $t0, 22
 sw $t0, -92($sp)
-lw $t1, -88($sp)
-lw $t2, -92($sp)
-or $t0, $t1, $t2
+li $t0, 33
 sw $t0, -96($sp)
-li $t0, 22
+lw $t1, -92($sp)
+lw $t2, -96($sp)
+sgt $t0, $t1, $t2
 sw $t0, -100($sp)
-li $t0, 33
+lw $t1, -88($sp)
+lw $t2, -100($sp)
+or $t0, $t1, $t2
 sw $t0, -104($sp)
-lw $t1, -100($sp)
-lw $t2, -104($sp)
-sgt $t0, $t1, $t2
+lw $t1, -92($sp)
+lw $t2, -96($sp)
+seq $t0, $t1, $t2
 sw $t0, -108($sp)
-lw $t1, -96($sp)
+lw $t1, -104($sp)
 lw $t2, -108($sp)
 or $t0, $t1, $t2
 sw $t0, -112($sp)
-li $t0, 22
-sw $t0, -116($sp)
-li $t0, 33
-sw $t0, -120($sp)
-lw $t1, -116($sp)
-lw $t2, -120($sp)
-seq $t0, $t1, $t2
-sw $t0, -124($sp)
-lw $t1, -112($sp)
-lw $t2, -124($sp)
-or $t0, $t1, $t2
-sw $t0, -128($sp)
-lw $t0, -128($sp)
+lw $t0, -112($sp)
 beqz $t0, label8
 la $a0, str_20
 li $v0, 4
@@ -189,54 +181,52 @@ li $v0, 11
 syscall
 label9:
 li $t0, 1
-sw $t0, -132($sp)
+sw $t0, -116($sp)
 li $t0, 2
-sw $t0, -136($sp)
-lw $t1, -132($sp)
-lw $t2, -136($sp)
+sw $t0, -120($sp)
+lw $t1, -116($sp)
+lw $t2, -120($sp)
 slt $t0, $t1, $t2
-sw $t0, -140($sp)
+sw $t0, -124($sp)
 li $t0, 55
-sw $t0, -144($sp)
+sw $t0, -128($sp)
 li $t0, 30
-sw $t0, -148($sp)
-lw $t1, -144($sp)
-lw $t2, -148($sp)
+sw $t0, -132($sp)
+lw $t1, -128($sp)
+lw $t2, -132($sp)
 sgt $t0, $t1, $t2
-sw $t0, -152($sp)
-lw $t1, -140($sp)
-lw $t2, -152($sp)
+sw $t0, -136($sp)
+lw $t1, -124($sp)
+lw $t2, -136($sp)
 sne $t3, $t1, $zero
 sne $t4, $t2, $zero
 and $t0, $t3, $t4
-sw $t0, -156($sp)
-li $t0, 22
-sw $t0, -160($sp)
+sw $t0, -140($sp)
 li $t0, 22
-sw $t0, -164($sp)
-lw $t1, -160($sp)
-lw $t2, -164($sp)
+sw $t0, -144($sp)
+lw $t1, -144($sp)
+lw $t2, -144($sp)
 seq $t0, $t1, $t2
-sw $t0, -168($sp)
-lw $t1, -156($sp)
-lw $t2, -168($sp)
+sw $t0, -148($sp)
+lw $t1, -140($sp)
+lw $t2, -148($sp)
 sne $t3, $t1, $zero
 sne $t4, $t2, $zero
 and $t0, $t3, $t4
-sw $t0, -172($sp)
+sw $t0, -152($sp)
 li $t0, 100
-sw $t0, -176($sp)
+sw $t0, -156($sp)
 li $t0, 200
-sw $t0, -180($sp)
-lw $t1, -176($sp)
-lw $t2, -180($sp)
+sw $t0, -160($sp)
+lw $t1, -156($sp)
+lw $t2, -160($sp)
 sgt $t0, $t1, $t2
-sw $t0, -184($sp)
-lw $t1, -172($sp)
-lw $t2, -184($sp)
+sw $t0, -164($sp)
+lw $t1, -152($sp)
+lw $t2, -164($sp)
 or $t0, $t1, $t2
-sw $t0, -188($sp)
-lw $t0, -188($sp)
+sw $t0, -168($sp)
+lw $t0, -168($sp)
 beqz $t0, label10
 la $a0, str_29
 li $v0, 4
@@ -254,208 +244,161 @@ li $v0, 11
 syscall
 label11:
 li $t0, 9
-sw $t0, -196($sp)
-lw $t1, -196($sp)
-sw $t1, -192($sp)
+sw $t0, -176($sp)
+lw $t1, -176($sp)
+sb $t1, -169($sp)
 li $t0, 5
-sw $t0, -204($sp)
+sw $t0, -184($sp)
 li $t0, 3
-sw $t0, -208($sp)
-lw $t1, -204($sp)
-lw $t2, -208($sp)
+sw $t0, -188($sp)
+lw $t1, -184($sp)
+lw $t2, -188($sp)
 sub $t0, $t1, $t2
-sw $t0, -212($sp)
+sw $t0, -192($sp)
 li $t0, 2
-sw $t0, -216($sp)
-lw $t1, -212($sp)
-lw $t2, -216($sp)
+sw $t0, -196($sp)
+lw $t1, -192($sp)
+lw $t2, -196($sp)
 sub $t0, $t1, $t2
-sw $t0, -220($sp)
-lw $t1, -220($sp)
-sw $t1, -200($sp)
+sw $t0, -200($sp)
+lw $t1, -200($sp)
+sw $t1, -180($sp)
 la $a0, str_33
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
-li $t0, 5
-sw $t0, -224($sp)
-li $t0, 3
-sw $t0, -228($sp)
-lw $t1, -224($sp)
-lw $t2, -228($sp)
-sub $t0, $t1, $t2
-sw $t0, -232($sp)
-li $t0, 2
-sw $t0, -236($sp)
-lw $t1, -232($sp)
-lw $t2, -236($sp)
+lw $t1, -192($sp)
+lw $t2, -196($sp)
 add $t0, $t1, $t2
-sw $t0, -240($sp)
-lw $t1, -240($sp)
-sw $t1, -200($sp)
-la $a0, str_36
+sw $t0, -204($sp)
+lw $t1, -204($sp)
+sw $t1, -180($sp)
+la $a0, str_35
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
-li $t0, 5
-sw $t0, -244($sp)
-li $t0, 3
-sw $t0, -248($sp)
-li $t0, 5
-sw $t0, -252($sp)
-lw $t1, -248($sp)
-lw $t2, -252($sp)
+lw $t1, -188($sp)
+lw $t2, -184($sp)
 mult $t1, $t2
 mflo $t0
-sw $t0, -256($sp)
-lw $t1, -244($sp)
-lw $t2, -256($sp)
+sw $t0, -208($sp)
+lw $t1, -184($sp)
+lw $t2, -208($sp)
 sub $t0, $t1, $t2
-sw $t0, -260($sp)
-lw $t1, -260($sp)
-sw $t1, -200($sp)
-la $a0, str_39
+sw $t0, -212($sp)
+lw $t1, -212($sp)
+sw $t1, -180($sp)
+la $a0, str_38
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
-li $t0, 5
-sw $t0, -264($sp)
-li $t0, 3
-sw $t0, -268($sp)
-lw $t1, -264($sp)
-lw $t2, -268($sp)
-sub $t0, $t1, $t2
-sw $t0, -272($sp)
-li $t0, 5
-sw $t0, -276($sp)
-lw $t1, -272($sp)
-lw $t2, -276($sp)
+lw $t1, -192($sp)
+lw $t2, -184($sp)
 mult $t1, $t2
 mflo $t0
-sw $t0, -280($sp)
-lw $t1, -280($sp)
-sw $t1, -200($sp)
-la $a0, str_42
+sw $t0, -216($sp)
+lw $t1, -216($sp)
+sw $t1, -180($sp)
+la $a0, str_40
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
 li $t0, 30
-sw $t0, -284($sp)
-li $t0, 5
-sw $t0, -288($sp)
-lw $t1, -284($sp)
-lw $t2, -288($sp)
+sw $t0, -220($sp)
+lw $t1, -220($sp)
+lw $t2, -184($sp)
 div $t1, $t2
 mflo $t0
-sw $t0, -292($sp)
-li $t0, 2
-sw $t0, -296($sp)
-lw $t1, -292($sp)
-lw $t2, -296($sp)
+sw $t0, -224($sp)
+lw $t1, -224($sp)
+lw $t2, -196($sp)
 div $t1, $t2
 mflo $t0
-sw $t0, -300($sp)
-lw $t1, -300($sp)
-sw $t1, -200($sp)
-la $a0, str_45
+sw $t0, -228($sp)
+lw $t1, -228($sp)
+sw $t1, -180($sp)
+la $a0, str_43
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
-li $t0, 30
-sw $t0, -304($sp)
-li $t0, 5
-sw $t0, -308($sp)
-lw $t1, -304($sp)
-lw $t2, -308($sp)
-div $t1, $t2
-mflo $t0
-sw $t0, -312($sp)
-li $t0, 2
-sw $t0, -316($sp)
-lw $t1, -312($sp)
-lw $t2, -316($sp)
+lw $t1, -224($sp)
+lw $t2, -196($sp)
 mult $t1, $t2
 mflo $t0
-sw $t0, -320($sp)
-lw $t1, -320($sp)
-sw $t1, -200($sp)
-la $a0, str_48
+sw $t0, -232($sp)
+lw $t1, -232($sp)
+sw $t1, -180($sp)
+la $a0, str_45
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
-li $t0, 30
-sw $t0, -324($sp)
-li $t0, 5
-sw $t0, -328($sp)
-li $t0, 2
-sw $t0, -332($sp)
-lw $t1, -328($sp)
-lw $t2, -332($sp)
+lw $t1, -184($sp)
+lw $t2, -196($sp)
 mult $t1, $t2
 mflo $t0
-sw $t0, -336($sp)
-lw $t1, -324($sp)
-lw $t2, -336($sp)
+sw $t0, -236($sp)
+lw $t1, -220($sp)
+lw $t2, -236($sp)
 div $t1, $t2
 mflo $t0
-sw $t0, -340($sp)
-lw $t1, -340($sp)
-sw $t1, -200($sp)
-la $a0, str_51
+sw $t0, -240($sp)
+lw $t1, -240($sp)
+sw $t1, -180($sp)
+la $a0, str_48
 li $v0, 4
 syscall
-lw $a0, -192($sp)
+lbu $a0, -169($sp)
 li $v0, 11
 syscall
-lw $a0, -200($sp)
+lw $a0, -180($sp)
 li $v0, 1
 syscall
 li $a0, '\n'
@@ -482,9 +425,9 @@ str_21: 		 .asciiz "SUCCESS"
 str_29: 		 .asciiz "SUCCESS"
 str_30: 		 .asciiz "FAIL"
 str_33: 		 .asciiz "should be 0:  "
-str_36: 		 .asciiz "should be 4:  "
-str_39: 		 .asciiz "should be -10:"
-str_42: 		 .asciiz "should be 10: "
-str_45: 		 .asciiz "should be 3:  "
-str_48: 		 .asciiz "should be 12: "
-str_51: 		 .asciiz "should be 3:  "
+str_35: 		 .asciiz "should be 4:  "
+str_38: 		 .asciiz "should be -10:"
+str_40: 		 .asciiz "should be 10: "
+str_43: 		 .asciiz "should be 3:  "
+str_45: 		 .asciiz "should be 12: "
+str_48: 		 .asciiz "should be 3:  "
@@ -71,155 +71,137 @@ li $t0, 8
 sw $t0, -140($sp)
 lw $t1, -140($sp)
 sw $t1, -60($sp)
-li $t0, 19
-sw $t0, -144($sp)
-lw $t1, -144($sp)
+lw $t1, -96($sp)
 sw $t1, -64($sp)
 li $t0, 20
-sw $t0, -148($sp)
-lw $t1, -148($sp)
+sw $t0, -144($sp)
+lw $t1, -144($sp)
 sw $t1, -68($sp)
 li $t0, 3
-sw $t0, -152($sp)
-lw $t1, -152($sp)
+sw $t0, -148($sp)
+lw $t1, -148($sp)
 sw $t1, -72($sp)
 li $t0, 28
-sw $t0, -156($sp)
-lw $t1, -156($sp)
+sw $t0, -152($sp)
+lw $t1, -152($sp)
 sw $t1, -76($sp)
 li $t0, 0
+sw $t0, -180($sp)
+lw $t1, -180($sp)
+sw $t1, -176($sp)
+lw $t1, -144($sp)
+sw $t1, -156($sp)
+li $t0, 121
 sw $t0, -184($sp)
 lw $t1, -184($sp)
-sw $t1, -180($sp)
-li $t0, 20
-sw $t0, -188($sp)
-lw $t1, -188($sp)
-sw $t1, -160($sp)
-li $t0, 121
-sw $t0, -192($sp)
-lw $t1, -192($sp)
-sw $t1, -176($sp)
+sb $t1, -169($sp)
 label0:
 li $t0, 121
-sw $t0, -196($sp)
-lw $t1, -176($sp)
-lw $t2, -196($sp)
+sw $t0, -188($sp)
+lbu $t1, -169($sp)
+lw $t2, -188($sp)
 seq $t0, $t1, $t2
-sw $t0, -200($sp)
-lw $t0, -200($sp)
+sw $t0, -192($sp)
+lw $t0, -192($sp)
 beqz $t0, label1
 li $t0, 1
-sw $t0, -204($sp)
-lw $t1, -204($sp)
-sw $t1, -164($sp)
+sw $t0, -196($sp)
+lw $t1, -196($sp)
+sw $t1, -160($sp)
 li $t0, 0
-sw $t0, -208($sp)
-lw $t1, -208($sp)
+sw $t0, -200($sp)
+lw $t1, -200($sp)
+sw $t1, -164($sp)
+lw $t1, -200($sp)
 sw $t1, -168($sp)
-li $t0, 0
-sw $t0, -212($sp)
-lw $t1, -212($sp)
-sw $t1, -172($sp)
 label2:
 li $t0, 4
-sw $t0, -216($sp)
-lw $t1, -164($sp)
-lw $t2, -216($sp)
+sw $t0, -204($sp)
+lw $t1, -160($sp)
+lw $t2, -204($sp)
 slt $t0, $t1, $t2
-sw $t0, -220($sp)
-lw $t0, -180($sp)
+sw $t0, -208($sp)
+lw $t0, -176($sp)
 add $t0, $t0, $t0
 add $t0, $t0, $t0
 li $t1, 0
 sub $t0, $t1, $t0
-sw $t0, -224($sp)
+sw $t0, -212($sp)
 move $t0, $sp
-lw $t1, -224($sp)
+lw $t1, -212($sp)
 add $t3, $t0, $t1
-lw $t1, -168($sp)
+lw $t1, -164($sp)
 lw $t2, ($t3)
 slt $t0, $t1, $t2
-sw $t0, -228($sp)
-lw $t0, -180($sp)
-add $t0, $t0, $t0
-add $t0, $t0, $t0
-li $t1, 0
-sub $t0, $t1, $t0
-sw $t0, -232($sp)
+sw $t0, -216($sp)
 move $t0, $sp
-lw $t1, -232($sp)
+lw $t1, -212($sp)
 add $t4, $t0, $t1
-lw $t1, -168($sp)
+lw $t1, -164($sp)
 lw $t2, ($t4)
 sgt $t0, $t1, $t2
-sw $t0, -236($sp)
-lw $t1, -228($sp)
-lw $t2, -236($sp)
+sw $t0, -220($sp)
+lw $t1, -216($sp)
+lw $t2, -220($sp)
 or $t0, $t1, $t2
-sw $t0, -240($sp)
-lw $t1, -220($sp)
-lw $t2, -240($sp)
+sw $t0, -224($sp)
+lw $t1, -208($sp)
+lw $t2, -224($sp)
 sne $t3, $t1, $zero
 sne $t4, $t2, $zero
 and $t0, $t3, $t4
-sw $t0, -244($sp)
-lw $t0, -244($sp)
+sw $t0, -228($sp)
+lw $t0, -228($sp)
 beqz $t0, label3
-la $a0, str_8
+la $a0, str_7
 li $v0, 4
 syscall
-lw $a0, -164($sp)
+lw $a0, -160($sp)
 li $v0, 1
 syscall
-la $a0, str_9
+la $a0, str_8
 li $v0, 4
 syscall
 li $v0, 5
 syscall
-sw $v0, -168($sp)
-lw $t0, -180($sp)
-add $t0, $t0, $t0
-add $t0, $t0, $t0
-li $t1, 0
-sub $t0, $t1, $t0
-sw $t0, -248($sp)
+sw $v0, -164($sp)
 move $t0, $sp
-lw $t1, -248($sp)
+lw $t1, -212($sp)
 add $t5, $t0, $t1
-lw $t1, -168($sp)
+lw $t1, -164($sp)
 lw $t2, ($t5)
 seq $t0, $t1, $t2
-sw $t0, -252($sp)
-lw $t0, -252($sp)
+sw $t0, -232($sp)
+lw $t0, -232($sp)
 beqz $t0, label4
-la $a0, str_12
+la $a0, str_10
 li $v0, 4
 syscall
 li $a0, '\n'
 li $v0, 11
 syscall
 li $t0, 1
-sw $t0, -256($sp)
-lw $t1, -256($sp)
-sw $t1, -172($sp)
+sw $t0, -236($sp)
+lw $t1, -236($sp)
+sw $t1, -168($sp)
 b label5
 label4:
-lw $t0, -180($sp)
+lw $t0, -176($sp)
 add $t0, $t0, $t0
 add $t0, $t0, $t0
 li $t1, 0
 sub $t0, $t1, $t0
-sw $t0, -260($sp)
+sw $t0, -240($sp)
 move $t0, $sp
-lw $t1, -260($sp)
+lw $t1, -240($sp)
 add $t6, $t0, $t1
-lw $t1, -168($sp)
+lw $t1, -164($sp)
 lw $t2, ($t6)
 slt $t0, $t1, $t2
-sw $t0, -264($sp)
-lw $t0, -264($sp)
+sw $t0, -244($sp)
+lw $t0, -244($sp)
 beqz $t0, label6
-la $a0, str_15
+la $a0, str_13
 li $v0, 4
 syscall
 li $a0, '\n'
@@ -227,22 +209,22 @@ li $v0, 11
 syscall
 b label7
 label6:
-lw $t0, -180($sp)
+lw $t0, -176($sp)
 add $t0, $t0, $t0
 add $t0, $t0, $t0
 li $t1, 0
 sub $t0, $t1, $t0
-sw $t0, -268($sp)
+sw $t0, -248($sp)
 move $t0, $sp
-lw $t1, -268($sp)
+lw $t1, -248($sp)
 add $t7, $t0, $t1
-lw $t1, -168($sp)
+lw $t1, -164($sp)
 lw $t2, ($t7)
 sgt $t0, $t1, $t2
-sw $t0, -272($sp)
-lw $t0, -272($sp)
+sw $t0, -252($sp)
+lw $t0, -252($sp)
 beqz $t0, label8
-la $a0, str_18
+la $a0, str_16
 li $v0, 4
 syscall
 li $a0, '\n'
@@ -254,24 +236,24 @@ label9:
 label7:
 label5:
 li $t0, 1
-sw $t0, -276($sp)
-lw $t1, -164($sp)
-lw $t2, -276($sp)
+sw $t0, -256($sp)
+lw $t1, -160($sp)
+lw $t2, -256($sp)
 add $t0, $t1, $t2
-sw $t0, -280($sp)
-lw $t1, -280($sp)
-sw $t1, -164($sp)
+sw $t0, -260($sp)
+lw $t1, -260($sp)
+sw $t1, -160($sp)
 b label2
 label3:
 li $t0, 0
-sw $t0, -284($sp)
-lw $t1, -172($sp)
-lw $t2, -284($sp)
+sw $t0, -264($sp)
+lw $t1, -168($sp)
+lw $t2, -264($sp)
 seq $t0, $t1, $t2
-sw $t0, -288($sp)
-lw $t0, -288($sp)
+sw $t0, -268($sp)
+lw $t0, -268($sp)
 beqz $t0, label10
-la $a0, str_21
+la $a0, str_19
 li $v0, 4
 syscall
 li $a0, '\n'
@@ -283,12 +265,12 @@ syscall
 b label11
 label10:
 label11:
-la $a0, str_22
+la $a0, str_20
 li $v0, 4
 syscall
 li $v0, 12
 syscall
-sw $v0, -176($sp)
+sb $v0, -169($sp)
 li $a0, '\n'
 li $v0, 11
 syscall
@@ -296,23 +278,23 @@ li $a0, '\n'
 li $v0, 11
 syscall
 li $t0, 1
-sw $t0, -292($sp)
-lw $t1, -180($sp)
-lw $t2, -292($sp)
+sw $t0, -272($sp)
+lw $t1, -176($sp)
+lw $t2, -272($sp)
 add $t0, $t1, $t2
-sw $t0, -296($sp)
-lw $t1, -296($sp)
-sw $t1, -180($sp)
-lw $t1, -180($sp)
-lw $t2, -160($sp)
+sw $t0, -276($sp)
+lw $t1, -276($sp)
+sw $t1, -176($sp)
+lw $t1, -176($sp)
+lw $t2, -156($sp)
 sgt $t0, $t1, $t2
-sw $t0, -300($sp)
-lw $t0, -300($sp)
+sw $t0, -280($sp)
+lw $t0, -280($sp)
 beqz $t0, label12
 li $t0, 0
-sw $t0, -304($sp)
-lw $t1, -304($sp)
-sw $t1, -180($sp)
+sw $t0, -284($sp)
+lw $t1, -284($sp)
+sw $t1, -176($sp)
 b label13
 label12:
 label13:
@@ -328,10 +310,10 @@ syscall
 .data
 ProgStart: 	 .asciiz "Program Start\n"
 ProgEnd:   	 .asciiz "Program End\n"
-str_8: 		 .asciiz "Chance #"
-str_9: 		 .asciiz " - guess a number (1-35): "
-str_12: 		 .asciiz "  YOU WIN!!!"
-str_15: 		 .asciiz "  guess higher"
-str_18: 		 .asciiz "  guess lower"
-str_21: 		 .asciiz "Sorry, you lost."
-str_22: 		 .asciiz "continue (y/n) ? "
+str_7: 		 .asciiz "Chance #"
+str_8: 		 .asciiz " - guess a number (1-35): "
+str_10: 		 .asciiz "  YOU WIN!!!"
+str_13: 		 .asciiz "  guess higher"
+str_16: 		 .asciiz "  guess lower"
+str_19: 		 .asciiz "Sorry, you lost."
+str_20: 		 .asciiz "continue (y/n) ? "
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Check that --stream keeps the memory use of cmm independent of the
+length of the program.
+
+Compiles a small and a large program from large_program.py with
+--stream, with and without --emit-stats, and prints the peak resident
+set size of each run.  Fails if the large program needs more than LIMIT
+percent of what the small one does.
+
+usage: check_rss.py [path/to/cmm]
+"""
+import os
+import subprocess
+import sys
+import tempfile
+
+SMALL = 500             # functions
+LARGE = 4000
+LIMIT = 125             # percent
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def peak_rss_kb(command, workdir):
+    """run command in workdir and return its peak RSS in kilobytes"""
+    child = subprocess.Popen(command, cwd=workdir,
+                             stdout=subprocess.DEVNULL)
+    _, status, usage = os.wait4(child.pid, 0)
+    if status != 0:
+        sys.exit("failed: " + " ".join(command))
+    return usage.ru_maxrss      # kilobytes on Linux
+
+
+def main():
+    cmm = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else "cmm")
+    modes = [["--stream"], ["--stream", "--emit-stats=stats.json"]]
+    failed = False
+
+    with tempfile.TemporaryDirectory() as workdir:
+        sources = {}
+        for n in (SMALL, LARGE):
+            sources[n] = os.path.join(workdir, "large%d.cmm" % n)
+            with open(sources[n], "w") as out:
+                subprocess.check_call([sys.executable,
+                                       os.path.join(HERE, "large_program.py"),
+                                       str(n)], stdout=out)
+
+        for flags in modes:
+            small = peak_rss_kb([cmm] + flags + [sources[SMALL]], workdir)
+            large = peak_rss_kb([cmm] + flags + [sources[LARGE]], workdir)
+            ok = large * 100 <= small * LIMIT
+            failed = failed or not ok
+            print("%-30s %5d functions: %6d KB  %5d functions: %6d KB  %s"
+                  % (" ".join(flags), SMALL, small, LARGE, large,
+                     "ok" if ok else "FAILED"))
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
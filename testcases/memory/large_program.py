@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""Write a C Minus Minus program with N functions to standard output.
+
+The functions are all alike: loops over a local array, an if/else, a
+nested scope and string literals, so the program grows with N while its
+largest function does not.
+
+usage: large_program.py N > large.cmm
+"""
+import sys
+
+
+def write_function(out, f):
+    out.write("int f%d() {\n"
+              " int a[20];\n"
+              " char c;\n"
+              " int i;\n"
+              " int s;\n"
+              " i = 0;\n"
+              " s = 0;\n" % f)
+    for k in range(5):
+        out.write(" while (i < 20) {\n"
+                  "  a[i] = i * %d + s;\n"
+                  "  if (a[i] > 100) { s = s - a[i]; }"
+                  " else { s = s + a[i] * 2; }\n"
+                  "  i = i + 1;\n"
+                  " }\n" % k)
+        out.write(' cout << "function %d block %d: " << s << endl;\n'
+                  " {\n"
+                  "  int t;\n"
+                  "  t = s + %d;\n"
+                  "  cout << t << endl;\n"
+                  " }\n"
+                  " i = 0;\n" % (f, k, k))
+    out.write("}\n")
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    for f in range(int(sys.argv[1])):
+        write_function(sys.stdout, f)
+    sys.stdout.write('int main() {\n cout << "done" << endl;\n}\n')
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,148 @@
+# Prolog:
+.text
+main:
+move $fp $sp
+la $a0 ProgStart
+li $v0 4
+syscall
+# End of Prolog
+
+li $t0, 0
+sw $t0, -16($sp)
+lw $t1, -16($sp)
+sw $t1, -4($sp)
+lw $t1, -16($sp)
+sw $t1, -8($sp)
+lw $t1, -16($sp)
+sw $t1, 0($sp)
+b label0
+label0_body:
+li $t0, 15
+sw $t0, -28($sp)
+lw $t1, 0($sp)
+lw $t2, -28($sp)
+slt $t0, $t1, $t2
+sw $t0, -32($sp)
+lw $t0, -32($sp)
+beqz $t0, label2
+li $t0, 1
+sw $t0, -36($sp)
+lw $t1, -4($sp)
+lw $t2, -36($sp)
+add $t0, $t1, $t2
+sw $t0, -40($sp)
+lw $t1, -40($sp)
+sw $t1, -4($sp)
+label3:
+li $t0, 17
+sw $t0, -52($sp)
+lw $t1, 0($sp)
+lw $t2, -52($sp)
+sgt $t0, $t1, $t2
+sw $t0, -56($sp)
+lw $t0, -56($sp)
+bnez $t0, label4_then
+label4:
+label5:
+li $t0, 1
+sw $t0, -60($sp)
+lw $t1, 0($sp)
+lw $t2, -60($sp)
+add $t0, $t1, $t2
+sw $t0, -64($sp)
+lw $t1, -64($sp)
+sw $t1, 0($sp)
+label0:
+li $t0, 20
+sw $t0, -20($sp)
+lw $t1, 0($sp)
+lw $t2, -20($sp)
+slt $t0, $t1, $t2
+sw $t0, -24($sp)
+lw $t0, -24($sp)
+bnez $t0, label0_body
+label1:
+la $a0, str_7
+li $v0, 4
+syscall
+lw $a0, -4($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+la $a0, str_8
+li $v0, 4
+syscall
+lw $a0, -8($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+li $t0, 0
+sw $t0, -68($sp)
+lw $t1, -68($sp)
+sw $t1, -12($sp)
+label6:
+li $t0, 0
+sw $t0, -72($sp)
+lw $t1, -12($sp)
+lw $t2, -72($sp)
+sgt $t0, $t1, $t2
+sw $t0, -76($sp)
+lw $t0, -76($sp)
+beqz $t0, label7
+li $t0, 1
+sw $t0, -80($sp)
+lw $t1, -12($sp)
+lw $t2, -80($sp)
+sub $t0, $t1, $t2
+sw $t0, -84($sp)
+lw $t1, -84($sp)
+sw $t1, -12($sp)
+b label6
+label7:
+la $a0, str_11
+li $v0, 4
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+
+# Postlog:
+la $a0 ProgEnd
+li $v0 4
+syscall
+li $v0 10
+syscall
+
+# Cold code:
+label2:
+li $t0, 1
+sw $t0, -44($sp)
+lw $t1, -8($sp)
+lw $t2, -44($sp)
+add $t0, $t1, $t2
+sw $t0, -48($sp)
+lw $t1, -48($sp)
+sw $t1, -8($sp)
+b label3
+label4_then:
+la $a0, str_5
+li $v0, 4
+syscall
+lw $a0, 0($sp)
+li $v0, 1
+syscall
+li $a0, '\n'
+li $v0, 11
+syscall
+b label5
+.data
+ProgStart: 	 .asciiz "Program Start\n"
+ProgEnd:   	 .asciiz "Program End\n"
+str_5: 		 .asciiz "late: "
+str_7: 		 .asciiz "small: "
+str_8: 		 .asciiz "big: "
+str_11: 		 .asciiz "done"